@@ -0,0 +1,98 @@
+/*
+  Compile-time cost of 31 curves x 1024 entries tables
+  Measure the compiler (the program only prints a checksum).
+  e.g.
+  g++ -std=c++14 -O0 -DGOBLIB_EASING_USING_FORCE_OWN_MATH -Isrc bench/compile/table_31x1024.cpp
+*/
+#include <gob_easing.hpp>
+#include <cstdio>
+#include <cstddef>
+
+#if __cplusplus < 201402L
+# error "Needs C++14 or later"
+#endif
+
+#ifndef TABLE_TYPE
+# define TABLE_TYPE float
+#endif
+
+namespace
+{
+constexpr std::size_t entries = 1024;
+using value_type = TABLE_TYPE;
+using function = value_type(*)(const value_type);
+
+struct table
+{
+    value_type v[entries];
+};
+
+template<function F> constexpr table make_table()
+{
+    table t{};
+    for(std::size_t i = 0; i < entries; ++i)
+    {
+        t.v[i] = F(static_cast<value_type>(i) / static_cast<value_type>(entries - 1));
+    }
+    return t;
+}
+
+#define TABLE(name) constexpr table name = make_table<goblib::easing::name<value_type>>()
+TABLE(linear);
+TABLE(inSinusoidal);
+TABLE(outSinusoidal);
+TABLE(inOutSinusoidal);
+TABLE(inQuadratic);
+TABLE(outQuadratic);
+TABLE(inOutQuadratic);
+TABLE(inCubic);
+TABLE(outCubic);
+TABLE(inOutCubic);
+TABLE(inQuartic);
+TABLE(outQuartic);
+TABLE(inOutQuartic);
+TABLE(inQuintic);
+TABLE(outQuintic);
+TABLE(inOutQuintic);
+TABLE(inExponential);
+TABLE(outExponential);
+TABLE(inOutExponential);
+TABLE(inCircular);
+TABLE(outCircular);
+TABLE(inOutCircular);
+TABLE(inBack);
+TABLE(outBack);
+TABLE(inOutBack);
+TABLE(inElastic);
+TABLE(outElastic);
+TABLE(inOutElastic);
+TABLE(inBounce);
+TABLE(outBounce);
+TABLE(inOutBounce);
+#undef TABLE
+
+const table* const tables[] =
+{
+    &linear,
+    &inSinusoidal, &outSinusoidal, &inOutSinusoidal,
+    &inQuadratic, &outQuadratic, &inOutQuadratic,
+    &inCubic, &outCubic, &inOutCubic,
+    &inQuartic, &outQuartic, &inOutQuartic,
+    &inQuintic, &outQuintic, &inOutQuintic,
+    &inExponential, &outExponential, &inOutExponential,
+    &inCircular, &outCircular, &inOutCircular,
+    &inBack, &outBack, &inOutBack,
+    &inElastic, &outElastic, &inOutElastic,
+    &inBounce, &outBounce, &inOutBounce,
+};
+static_assert(sizeof(tables) / sizeof(tables[0]) == 31, "oops!");
+//
+}
+
+int main()
+{
+    double sum{};
+    for(auto& t : tables) { for(auto& v : t->v) { sum += v; } }
+    std::printf("%zu x %zu checksum:%.9f\n", sizeof(tables) / sizeof(tables[0]), entries, sum);
+    return 0;
+}
@@ -0,0 +1,236 @@
+/*
+  Dispatch of curves chosen at runtime (ns/call, float)
+  Usage: program [samples]
+
+  Each sample holds its curve as the handle of the method (like a component):
+    pointer       Function pointer (bench::curves table, as the demo did)
+    switch        Curve and evaluate (switch)
+    Ease          Ease<float> (switch with the overshoot of Back)
+    template      Curve, dispatched once per run of the same curve to a loop instantiated for fn::curve<C>
+    std::function std::function<float(float)>
+    virtual       Pointer to an object with a virtual function
+  Patterns of the curves of samples:
+    same    One curve for all samples (averaged over the curves)
+    runs    Runs of 64 samples with the same curve, pseudo-random curve for each run
+    random  Pseudo-random curve for each sample
+
+  Each cell is the minimum of 3 repetitions.
+
+  Name lookup: find_curve (perfect hash) against a linear scan of the names (strcmp) and std::unordered_map,
+  for pseudo-random names of this library and with "ease" (easeInOutBack).
+*/
+#include "../harness/bench.hpp"
+#include <gob_easing_combinator.hpp>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+namespace easing = goblib::easing;
+namespace fn = goblib::easing::fn;
+using easing::Curve;
+using sequence = std::vector<std::uint8_t>;
+
+constexpr std::size_t run_length = 64;
+constexpr int repeats = 3;
+
+template<class Fn> double minimum(Fn f)
+{
+    double m = f();
+    for(int i = 1; i < repeats; ++i) { m = std::min(m, f()); }
+    return m;
+}
+
+inline float argument(const std::size_t i, const std::size_t samples)
+{
+    return static_cast<float>(i) / static_cast<float>(samples - 1);
+}
+
+// Per sample
+template<typename H, class Fn> double per_sample(const sequence& ids, Fn call, std::vector<H> handles)
+{
+    const std::size_t samples = ids.size();
+    return minimum([&]() { return bench::measure(samples, [&](const std::size_t i) { bench::keep(call(handles[i], argument(i, samples))); }); });
+}
+
+// template: a loop for each curve
+template<class F> void run(const std::size_t first, const std::size_t last, const std::size_t samples)
+{
+    for(std::size_t i = first; i < last; ++i) { bench::keep(F{}(argument(i, samples))); }
+}
+using run_function = void(*)(const std::size_t, const std::size_t, const std::size_t);
+template<std::size_t... I> constexpr std::array<run_function, sizeof...(I)> make_runs(std::index_sequence<I...>)
+{
+    return {{ run<fn::curve<static_cast<Curve>(I)>>... }};
+}
+constexpr auto runs = make_runs(std::make_index_sequence<easing::num_curves>{});
+
+double templated(const sequence& ids)
+{
+    const std::size_t samples = ids.size();
+    return minimum([&]() { return bench::measure(1, [&](const std::size_t)
+    {
+        std::size_t first = 0;
+        while(first < samples)
+        {
+            std::size_t last = first + 1;
+            while(last < samples && ids[last] == ids[first]) { ++last; }
+            runs[ids[first]](first, last, samples);
+            first = last;
+        }
+    }); }) / static_cast<double>(samples);
+}
+
+// virtual
+struct Base
+{
+    virtual ~Base() = default;
+    virtual float operator()(const float t) const = 0;
+};
+template<class F> struct Derived final : Base
+{
+    float operator()(const float t) const override { return F{}(t); }
+};
+template<std::size_t... I> std::vector<std::unique_ptr<Base>> make_objects(std::index_sequence<I...>)
+{
+    std::vector<std::unique_ptr<Base>> v;
+    using expand = int[];
+    (void)expand{ 0, (v.emplace_back(new Derived<fn::curve<static_cast<Curve>(I)>>()), 0)... };
+    return v;
+}
+
+struct Result
+{
+    double pointer{}, evaluate{}, ease{}, templated{}, function{}, object{};
+    Result& operator+=(const Result& r)
+    {
+        pointer += r.pointer; evaluate += r.evaluate; ease += r.ease;
+        templated += r.templated; function += r.function; object += r.object;
+        return *this;
+    }
+};
+
+Result run_all(const sequence& ids)
+{
+    static const auto objects = make_objects(std::make_index_sequence<easing::num_curves>{});
+    const auto& table = bench::curves<float>::table;
+    const std::size_t samples = ids.size();
+
+    std::vector<bench::ease_function<float>> pointers(samples);
+    std::vector<Curve> curves(samples);
+    std::vector<easing::Ease<float>> eases(samples);
+    std::vector<std::function<float(float)>> functions(samples);
+    std::vector<const Base*> bases(samples);
+    for(std::size_t i = 0; i < samples; ++i)
+    {
+        pointers[i] = table[ids[i]];
+        curves[i] = static_cast<Curve>(ids[i]);
+        eases[i] = easing::Ease<float>{curves[i]};
+        functions[i] = table[ids[i]];
+        bases[i] = objects[ids[i]].get();
+    }
+
+    Result r;
+    r.pointer = per_sample(ids, [](bench::ease_function<float> f, const float t) { return f(t); }, std::move(pointers));
+    r.evaluate = per_sample(ids, [](const Curve c, const float t) { return easing::evaluate(c, t); }, std::move(curves));
+    r.ease = per_sample(ids, [](const easing::Ease<float>& e, const float t) { return e(t); }, std::move(eases));
+    r.templated = templated(ids);
+    r.function = per_sample(ids, [](const std::function<float(float)>& f, const float t) { return f(t); }, std::move(functions));
+    r.object = per_sample(ids, [](const Base* b, const float t) { return (*b)(t); }, std::move(bases));
+    return r;
+}
+
+void print(const char* pattern, const Result& r)
+{
+    std::printf("%-8s %10.2f %10.2f %10.2f %10.2f %13.2f %10.2f\n",
+                pattern, r.pointer, r.evaluate, r.ease, r.templated, r.function, r.object);
+}
+
+std::uint32_t xorshift(std::uint32_t& x)
+{
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    return x;
+}
+
+void dispatch(const std::size_t samples)
+{
+    std::printf("## dispatch (ns/call, %zu samples)\n", samples);
+    std::printf("%-8s %10s %10s %10s %10s %13s %10s\n", "pattern", "pointer", "switch", "Ease", "template", "std::function", "virtual");
+
+    sequence ids(samples);
+    Result same;
+    for(std::size_t c = 0; c < easing::num_curves; ++c)
+    {
+        std::fill(ids.begin(), ids.end(), static_cast<std::uint8_t>(c));
+        same += run_all(ids);
+    }
+    const double n = static_cast<double>(easing::num_curves);
+    print("same", Result{same.pointer / n, same.evaluate / n, same.ease / n, same.templated / n, same.function / n, same.object / n});
+
+    std::uint32_t x = 2463534242U;
+    for(std::size_t i = 0; i < samples; ++i)
+    {
+        if(i % run_length == 0) { xorshift(x); }
+        ids[i] = static_cast<std::uint8_t>(x % easing::num_curves);
+    }
+    print("runs", run_all(ids));
+
+    for(auto& id : ids) { id = static_cast<std::uint8_t>(xorshift(x) % easing::num_curves); }
+    print("random", run_all(ids));
+}
+
+void lookup(const std::size_t samples)
+{
+    std::vector<std::string> names;
+    for(std::size_t c = 0; c < easing::num_curves; ++c)
+    {
+        const std::string n = easing::name(static_cast<Curve>(c));
+        std::string e = "ease" + n;
+        e[4] = static_cast<char>(std::toupper(e[4]));
+        names.push_back(n);
+        names.push_back(e);
+    }
+    std::unordered_map<std::string, Curve> map;
+    for(std::size_t i = 0; i < names.size(); ++i) { map.emplace(names[i], static_cast<Curve>(i / 2)); }
+
+    std::vector<const char*> keys(samples);
+    std::uint32_t x = 2463534242U;
+    for(auto& k : keys) { k = names[xorshift(x) % names.size()].c_str(); }
+
+    const double perfect = bench::measure(samples, [&](const std::size_t i) { bench::keep(easing::find_curve(keys[i]).curve); });
+    const double scan = bench::measure(samples, [&](const std::size_t i)
+    {
+        std::size_t n = 0;
+        while(n < names.size() && std::strcmp(names[n].c_str(), keys[i]) != 0) { ++n; }
+        bench::keep(n);
+    });
+    const double hashed = bench::measure(samples, [&](const std::size_t i) { bench::keep(map.find(keys[i])->second); });
+    std::printf("## name lookup (ns/call, %zu samples)\n", samples);
+    std::printf("%-10s %10s %13s\n", "find_curve", "scan", "unordered_map");
+    std::printf("%-10.2f %10.2f %13.2f\n", perfect, scan, hashed);
+}
+//
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t samples = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    if(samples < 2) { samples = 2; }
+
+#if defined(__FAST_MATH__)
+    std::printf("# -ffast-math\n");
+#endif
+    dispatch(samples);
+    lookup(samples);
+    return 0;
+}
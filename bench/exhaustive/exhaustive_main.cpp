@@ -0,0 +1,184 @@
+/*
+  Exhaustive verification of all float arguments in [0, 1] (1065353217 values)
+  Usage: program [curve] [stride]
+    curve  Name of the curve (e.g. inOutBack), "all" for all curves (default)
+    stride Test every stride-th float (default 1)
+
+  Reference is the double template with the exact policy.
+  Reports the maximum error and its argument for each implementation, in ULP of the reference and in absolute.
+  "exact", "balanced", "fast" and "deterministic" are float,
+  "fx" is Q16.16 (absolute only) against the reference at the argument rounded to Q16.16.
+  Relative errors are unbounded where the curve is near 0 and computed as 1 - g(1 - t) (e.g. outCubic),
+  so read the ULP table together with the absolute table.
+*/
+#include "../harness/bench.hpp"
+#include <gob_easing_deterministic.hpp>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace
+{
+namespace easing = goblib::easing;
+namespace fx = goblib::easing::fx;
+namespace precision = goblib::easing::precision;
+
+#define GOB_ALL_CURVES(prefix, suffix)                                                                 \
+    { prefix linear suffix,                                                                             \
+      prefix inSinusoidal suffix, prefix outSinusoidal suffix, prefix inOutSinusoidal suffix,           \
+      prefix inQuadratic suffix, prefix outQuadratic suffix, prefix inOutQuadratic suffix,              \
+      prefix inCubic suffix, prefix outCubic suffix, prefix inOutCubic suffix,                          \
+      prefix inQuartic suffix, prefix outQuartic suffix, prefix inOutQuartic suffix,                    \
+      prefix inQuintic suffix, prefix outQuintic suffix, prefix inOutQuintic suffix,                    \
+      prefix inExponential suffix, prefix outExponential suffix, prefix inOutExponential suffix,        \
+      prefix inCircular suffix, prefix outCircular suffix, prefix inOutCircular suffix,                 \
+      prefix inBack suffix, prefix outBack suffix, prefix inOutBack suffix,                             \
+      prefix inElastic suffix, prefix outElastic suffix, prefix inOutElastic suffix,                    \
+      prefix inBounce suffix, prefix outBounce suffix, prefix inOutBounce suffix }
+
+constexpr bench::ease_function<float> deterministic[] = GOB_ALL_CURVES(easing::deterministic::, <float>);
+constexpr fx::q16_t (*fixed[])(const fx::q16_t) = GOB_ALL_CURVES(fx::, );
+#undef GOB_ALL_CURVES
+constexpr std::size_t num_curves = bench::curves<float>::size;
+static_assert(sizeof(deterministic) / sizeof(deterministic[0]) == num_curves, "oops!");
+static_assert(sizeof(fixed) / sizeof(fixed[0]) == num_curves, "oops!");
+
+constexpr const char* impl_name[] = { "exact", "balanced", "fast", "deterministic", "fx" };
+constexpr std::size_t num_impls = sizeof(impl_name) / sizeof(impl_name[0]);
+constexpr std::size_t num_floats = num_impls - 1; // Without fx
+
+constexpr std::uint32_t last_bits = 0x3F800000U; // 1.0f
+constexpr std::uint32_t block = 1U << 16;
+
+struct Worst
+{
+    double err{};
+    float t{};
+    // Larger error, then smaller argument (same result for any number of threads)
+    void update(const double e, const float x)
+    {
+        if(e > err || (e == err && x < t)) { err = e; t = x; }
+    }
+};
+using Result = std::vector<Worst>; // [(curve * num_impls + impl) * 2 + (0: ULP, 1: absolute)]
+
+float to_float(const std::uint32_t bits)
+{
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// ULP of float at the magnitude of the reference
+double ulp(const double ref)
+{
+    if(ref == 0.0) { return std::ldexp(1.0, -149); }
+    int e;
+    std::frexp(ref, &e);
+    return std::ldexp(1.0, e - 24 < -149 ? -149 : e - 24);
+}
+double abs_error(const double v, const double ref)
+{
+    return std::isnan(v) ? std::numeric_limits<double>::infinity() : std::fabs(v - ref);
+}
+void update(Worst* w, const float v, const double ref, const float t)
+{
+    const double e = abs_error(v, ref);
+    w[0].update(e / ulp(ref), t);
+    w[1].update(e, t);
+}
+
+void sweep(const std::vector<std::size_t>& targets, const std::uint32_t stride, std::atomic<std::uint32_t>& next, Result& res)
+{
+    const auto& reference = bench::curves<double, precision::exact>::table;
+    const auto& exact = bench::curves<float, precision::exact>::table;
+    const auto& balanced = bench::curves<float, precision::balanced>::table;
+    const auto& fast = bench::curves<float, precision::fast>::table;
+
+    for(;;)
+    {
+        const std::uint32_t first = next.fetch_add(block);
+        if(first > last_bits) { break; }
+        const std::uint32_t end = (last_bits - first < block) ? last_bits + 1 : first + block;
+        for(std::uint32_t bits = (first + stride - 1) / stride * stride; bits < end; bits += stride)
+        {
+            const float t = to_float(bits);
+            for(auto c : targets)
+            {
+                const double ref = reference[c](static_cast<double>(t));
+                Worst* w = &res[c * num_impls * 2];
+                update(w, exact[c](t), ref, t);
+                update(w + 2, balanced[c](t), ref, t);
+                update(w + 4, fast[c](t), ref, t);
+                update(w + 6, deterministic[c](t), ref, t);
+                const fx::q16_t q = fx::from_float(t);
+                w[9].update(abs_error(fx::to_float<double>(fixed[c](q)), reference[c](fx::to_float<double>(q))), t);
+            }
+        }
+    }
+}
+//
+}
+
+int main(int argc, char** argv)
+{
+    const char* name = (argc > 1) ? argv[1] : "all";
+    const std::uint32_t stride = (argc > 2 && std::strtoul(argv[2], nullptr, 10) > 1) ? static_cast<std::uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 1U;
+
+    std::vector<std::size_t> targets;
+    for(std::size_t c = 0; c < num_curves; ++c)
+    {
+        if(std::strcmp(name, "all") == 0 || std::strcmp(name, bench::curve_name[c]) == 0) { targets.push_back(c); }
+    }
+    if(targets.empty())
+    {
+        std::fprintf(stderr, "Unknown curve: %s\n", name);
+        return 1;
+    }
+    const unsigned threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1U;
+
+#if defined(__FAST_MATH__)
+    std::printf("# -ffast-math\n");
+#endif
+    std::printf("## exhaustive (%u floats in [0, 1], stride %u, %u threads)\n", last_bits / stride + 1, stride, threads);
+    std::printf("Maximum error @ argument\n");
+
+    const auto start = std::chrono::steady_clock::now();
+    std::atomic<std::uint32_t> next{0};
+    std::vector<Result> results(threads, Result(num_curves * num_impls * 2));
+    std::vector<std::thread> pool;
+    for(unsigned i = 0; i < threads; ++i)
+    {
+        pool.emplace_back(sweep, std::cref(targets), stride, std::ref(next), std::ref(results[i]));
+    }
+    for(auto& th : pool) { th.join(); }
+    const double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    auto print = [&](const char* title, const std::size_t n, const std::size_t kind)
+    {
+        std::printf("### %s\n%-18s", title, "curve");
+        for(std::size_t i = 0; i < n; ++i) { std::printf(" %24s", impl_name[i]); }
+        std::printf("\n");
+        for(auto c : targets)
+        {
+            std::printf("%-18s", bench::curve_name[c]);
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                Worst w{};
+                for(auto& r : results) { w.update(r[(c * num_impls + i) * 2 + kind].err, r[(c * num_impls + i) * 2 + kind].t); }
+                std::printf(" %10.3g @%-12.9g", w.err, w.t);
+            }
+            std::printf("\n");
+        }
+    };
+    print("ULP", num_floats, 0);
+    print("absolute", num_impls, 1);
+    std::printf("# %.1f seconds\n", sec);
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+  Common helpers for gob_easing benchmark
+*/
+#ifndef GOB_EASING_BENCH_HPP
+#define GOB_EASING_BENCH_HPP
+
+#include <gob_easing.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace bench
+{
+template<typename T> using ease_function = T(*)(const T);
+
+// All easing functions
+template<typename T, class P = goblib::easing::precision::default_policy> struct curves
+{
+    static constexpr ease_function<T> table[] =
+    {
+        goblib::easing::linear<T, P>,
+        goblib::easing::inSinusoidal<T, P>,
+        goblib::easing::outSinusoidal<T, P>,
+        goblib::easing::inOutSinusoidal<T, P>,
+        goblib::easing::inQuadratic<T, P>,
+        goblib::easing::outQuadratic<T, P>,
+        goblib::easing::inOutQuadratic<T, P>,
+        goblib::easing::inCubic<T, P>,
+        goblib::easing::outCubic<T, P>,
+        goblib::easing::inOutCubic<T, P>,
+        goblib::easing::inQuartic<T, P>,
+        goblib::easing::outQuartic<T, P>,
+        goblib::easing::inOutQuartic<T, P>,
+        goblib::easing::inQuintic<T, P>,
+        goblib::easing::outQuintic<T, P>,
+        goblib::easing::inOutQuintic<T, P>,
+        goblib::easing::inExponential<T, P>,
+        goblib::easing::outExponential<T, P>,
+        goblib::easing::inOutExponential<T, P>,
+        goblib::easing::inCircular<T, P>,
+        goblib::easing::outCircular<T, P>,
+        goblib::easing::inOutCircular<T, P>,
+        goblib::easing::inBack<T, P>,
+        goblib::easing::outBack<T, P>,
+        goblib::easing::inOutBack<T, P>,
+        goblib::easing::inElastic<T, P>,
+        goblib::easing::outElastic<T, P>,
+        goblib::easing::inOutElastic<T, P>,
+        goblib::easing::inBounce<T, P>,
+        goblib::easing::outBounce<T, P>,
+        goblib::easing::inOutBounce<T, P>,
+    };
+    static constexpr std::size_t size = sizeof(table) / sizeof(table[0]);
+};
+template<typename T, class P> constexpr ease_function<T> curves<T, P>::table[];
+
+constexpr const char* curve_name[] =
+{
+    "linear",
+    "inSinusoidal", "outSinusoidal", "inOutSinusoidal",
+    "inQuadratic", "outQuadratic", "inOutQuadratic",
+    "inCubic", "outCubic", "inOutCubic",
+    "inQuartic", "outQuartic", "inOutQuartic",
+    "inQuintic", "outQuintic", "inOutQuintic",
+    "inExponential", "outExponential", "inOutExponential",
+    "inCircular", "outCircular", "inOutCircular",
+    "inBack", "outBack", "inOutBack",
+    "inElastic", "outElastic", "inOutElastic",
+    "inBounce", "outBounce", "inOutBounce",
+};
+static_assert(sizeof(curve_name) / sizeof(curve_name[0]) == curves<float>::size, "oops!");
+
+// Prevent the optimizer from discarding the result
+template<typename T> inline void keep(const T& v)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(&v) : "memory");
+#else
+    static volatile T sink; sink = v;
+#endif
+}
+
+// Nanoseconds per call of f(i) for i in [0, n)
+template<class Fn> double measure(const std::size_t n, Fn f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n; ++i) { f(i); }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (n ? n : 1);
+}
+
+// TSC cycles per call of f(i) for i in [0, n) (negative if not available)
+template<class Fn> double measure_cycles(const std::size_t n, Fn f)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    const auto start = __rdtsc();
+    for(std::size_t i = 0; i < n; ++i) { f(i); }
+    return static_cast<double>(__rdtsc() - start) / (n ? n : 1);
+#else
+    (void)n; (void)f;
+    return -1.0;
+#endif
+}
+
+// Suites
+void curves_suite(const std::size_t samples);
+void accuracy_suite(const std::size_t samples);
+void fixed_suite(const std::size_t samples);
+void kernel_suite(const std::size_t samples);
+//
+}
+#endif
@@ -0,0 +1,38 @@
+/*
+  Maximum absolute error of all curves in float and double.
+  Reference is long double of the same build, so the figures show the effect of build flags (e.g. -ffast-math).
+*/
+#include "bench.hpp"
+#include <cmath>
+
+namespace
+{
+template<typename T> long double max_error(const std::size_t idx, const std::size_t samples)
+{
+    auto func = bench::curves<T>::table[idx];
+    auto ref = bench::curves<long double, goblib::easing::precision::exact>::table[idx];
+    long double e{};
+    for(std::size_t i = 0; i < samples; ++i)
+    {
+        const T t = static_cast<T>(i) / static_cast<T>(samples - 1);
+        const long double d = std::fabs(static_cast<long double>(func(t)) - ref(static_cast<long double>(t)));
+        e = (d > e || d != d) ? d : e;
+    }
+    return e;
+}
+//
+}
+
+namespace bench
+{
+void accuracy_suite(const std::size_t samples)
+{
+    std::printf("## accuracy (max absolute error, %zu samples)\n", samples);
+    std::printf("%-18s %12s %12s\n", "curve", "float", "double");
+    for(std::size_t idx = 0; idx < curves<float>::size; ++idx)
+    {
+        std::printf("%-18s %12.3Le %12.3Le\n", curve_name[idx], max_error<float>(idx, samples), max_error<double>(idx, samples));
+    }
+}
+//
+}
@@ -0,0 +1,45 @@
+/*
+  Throughput of all curves in float, double and long double.
+  "ld as double" is long double computed in double (precision::long_double_as_double).
+  If GOBLIB_EASING_INSTRUMENT is defined, dump the iteration histograms of each curve.
+*/
+#include "bench.hpp"
+
+namespace
+{
+template<typename T, class P = goblib::easing::precision::default_policy>
+double run(const std::size_t idx, const std::size_t samples)
+{
+    auto func = bench::curves<T, P>::table[idx];
+    return bench::measure(samples, [&](const std::size_t i)
+    {
+        bench::keep(func(static_cast<T>(i) / static_cast<T>(samples - 1)));
+    });
+}
+//
+}
+
+namespace bench
+{
+void curves_suite(const std::size_t samples)
+{
+    std::printf("## curves (ns/call, %zu samples)\n", samples);
+    using ld_as_double = goblib::easing::precision::long_double_as_double<goblib::easing::precision::default_policy>;
+    std::printf("%-18s %10s %10s %12s %13s\n", "curve", "float", "double", "long double", "ld as double");
+    for(std::size_t idx = 0; idx < curves<float>::size; ++idx)
+    {
+#if defined(GOBLIB_EASING_INSTRUMENT)
+        goblib::easing::instrument::reset();
+#endif
+        auto f = run<float>(idx, samples);
+        auto d = run<double>(idx, samples);
+        auto ld = run<long double>(idx, samples);
+        auto ldd = run<long double, ld_as_double>(idx, samples);
+        std::printf("%-18s %10.2f %10.2f %12.2f %13.2f\n", curve_name[idx], f, d, ld, ldd);
+#if defined(GOBLIB_EASING_INSTRUMENT)
+        goblib::easing::instrument::dump(stdout, curve_name[idx]);
+#endif
+    }
+}
+//
+}
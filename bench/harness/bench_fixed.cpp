@@ -0,0 +1,165 @@
+/*
+  Integer time easing (fx::ease_int) against the float path.
+  "float" is t = elapsed / duration in float and the float curve,
+  "reciprocal" reuses fx::reciprocal, "uint32" passes std::uint32_t (one integer division per call).
+  Each cell of ease_int is the minimum of 5 repetitions.
+  LED brightness by fx::gamma_table against float curve, std::pow and quantization.
+  Exact Back and Bounce against the float curve and the Q30 evaluation.
+  Q1.15 batches by q15::transform against q15::simd::transform (SSE2, and AVX2 with -mavx2).
+*/
+#include "bench.hpp"
+#include <gob_easing_fixed.hpp>
+#include <gob_easing_fixed_simd.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+namespace fx = goblib::easing::fx;
+
+constexpr int repeats = 5;
+
+template<class Fn> double minimum(Fn f)
+{
+    double m = f();
+    for(int i = 1; i < repeats; ++i) { m = std::min(m, f()); }
+    return m;
+}
+
+template<fx::q16_t (*Fixed)(const fx::q16_t), float (*Float)(const float)>
+void run(const char* name, const std::size_t samples)
+{
+    const std::uint32_t duration = static_cast<std::uint32_t>(samples - 1);
+    const std::int32_t from = -1000, to = 3000;
+
+    auto f = minimum([&]() { return bench::measure(samples, [&](const std::size_t i)
+    {
+        const float t = static_cast<float>(i) / static_cast<float>(duration);
+        bench::keep(static_cast<std::int32_t>(std::lround(from + (to - from) * Float(t))));
+    }); });
+    const fx::reciprocal rec{duration};
+    auto r = minimum([&]() { return bench::measure(samples, [&](const std::size_t i)
+    {
+        bench::keep(fx::ease_int<Fixed>(static_cast<std::uint32_t>(i), rec, from, to));
+    }); });
+    volatile std::uint32_t vd = duration; // Not a constant
+    auto d = minimum([&]() { return bench::measure(samples, [&](const std::size_t i)
+    {
+        bench::keep(fx::ease_int<Fixed>(static_cast<std::uint32_t>(i), vd, from, to));
+    }); });
+    std::printf("%-18s %10.2f %12.2f %10.2f\n", name, f, r, d);
+}
+
+template<fx::q16_t (*Fixed)(const fx::q16_t), fx::detail::q30_t (*Q30)(const fx::detail::q30_t), float (*Float)(const float)>
+void run_exact(const char* name, const std::size_t samples)
+{
+    const fx::reciprocal rec{static_cast<std::uint32_t>(samples - 1)};
+    auto f = bench::measure(samples, [&](const std::size_t i)
+    {
+        bench::keep(Float(static_cast<float>(i) / static_cast<float>(samples - 1)));
+    });
+    auto q = bench::measure(samples, [&](const std::size_t i)
+    {
+        bench::keep(fx::detail::to16(Q30(fx::detail::to30(rec.ratio(static_cast<std::uint32_t>(i))))));
+    });
+    auto e = bench::measure(samples, [&](const std::size_t i)
+    {
+        bench::keep(Fixed(rec.ratio(static_cast<std::uint32_t>(i))));
+    });
+    std::printf("%-18s %10.2f %10.2f %10.2f\n", name, f, q, e);
+}
+
+// ns/sample for blocks of 4096 phases
+template<fx::q15::q15_t (*F)(const fx::q15::q15_t)> void run_batch(const char* name, const std::size_t samples)
+{
+    namespace q15 = fx::q15;
+    constexpr std::size_t block = 4096;
+    std::vector<q15::q15_t> in(block), out(block);
+    for(std::size_t i = 0; i < block; ++i) { in[i] = static_cast<q15::q15_t>(i * 8); }
+    const std::size_t rounds = samples / block + 1;
+    auto batch = [&](void (*fn)(const q15::q15_t*, q15::q15_t*, const std::size_t))
+    {
+        return bench::measure(rounds, [&](const std::size_t) { fn(in.data(), out.data(), block); bench::keep(out[block - 1]); }) / block;
+    };
+    std::printf("%-18s %10.3f", name, batch(q15::transform<F>));
+#if defined(GOBLIB_EASING_SIMD_SSE2)
+    std::printf(" %10.3f", batch(q15::simd::transform<F, q15::simd::sse2>));
+#endif
+#if defined(GOBLIB_EASING_SIMD_AVX2)
+    std::printf(" %10.3f", batch(q15::simd::transform<F, q15::simd::avx2>));
+#endif
+    std::printf("\n");
+}
+//
+}
+
+namespace bench
+{
+void fixed_suite(const std::size_t samples)
+{
+    std::printf("## ease_int (ns/call, %zu samples)\n", samples);
+    std::printf("%-18s %10s %12s %10s\n", "curve", "float", "reciprocal", "uint32");
+    run<fx::linear, goblib::easing::linear<float>>("linear", samples);
+    run<fx::inOutSinusoidal, goblib::easing::inOutSinusoidal<float>>("inOutSinusoidal", samples);
+    run<fx::inOutCubic, goblib::easing::inOutCubic<float>>("inOutCubic", samples);
+    run<fx::outExponential, goblib::easing::outExponential<float>>("outExponential", samples);
+    run<fx::outCircular, goblib::easing::outCircular<float>>("outCircular", samples);
+    run<fx::outBack, goblib::easing::outBack<float>>("outBack", samples);
+    run<fx::outElastic, goblib::easing::outElastic<float>>("outElastic", samples);
+    run<fx::outBounce, goblib::easing::outBounce<float>>("outBounce", samples);
+
+    std::printf("## Exact Back and Bounce (ns/call, %zu samples)\n", samples);
+    std::printf("%-18s %10s %10s %10s\n", "curve", "float", "Q30", "exact");
+    run_exact<fx::inBack, fx::detail::inBack, goblib::easing::inBack<float>>("inBack", samples);
+    run_exact<fx::outBack, fx::detail::outBack, goblib::easing::outBack<float>>("outBack", samples);
+    run_exact<fx::inOutBack, fx::detail::inOutBack, goblib::easing::inOutBack<float>>("inOutBack", samples);
+    run_exact<fx::inBounce, fx::detail::inBounce, goblib::easing::inBounce<float>>("inBounce", samples);
+    run_exact<fx::outBounce, fx::detail::outBounce, goblib::easing::outBounce<float>>("outBounce", samples);
+    run_exact<fx::inOutBounce, fx::detail::inOutBounce, goblib::easing::inOutBounce<float>>("inOutBounce", samples);
+
+    std::printf("## Q1.15 batch (ns/sample)\n");
+    std::printf("%-18s %10s %10s %10s\n", "curve", "scalar", "SSE2", "AVX2");
+    run_batch<fx::q15::inOutSinusoidal>("inOutSinusoidal", samples);
+    run_batch<fx::q15::inOutCubic>("inOutCubic", samples);
+    run_batch<fx::q15::inOutQuintic>("inOutQuintic", samples);
+    run_batch<fx::q15::outExponential>("outExponential", samples);
+    run_batch<fx::q15::outCircular>("outCircular", samples);
+
+    // LEDs have individual frames of 120
+    constexpr std::size_t frames = 120;
+    using fade = fx::gamma_table<goblib::easing::inOutSinusoidal<double>, frames>;
+    std::vector<std::uint8_t> frame(samples), out(samples);
+    std::vector<float> outf(samples);
+    for(std::size_t i = 0; i < samples; ++i) { frame[i] = static_cast<std::uint8_t>((i * 7) % frames); }
+
+    auto f = measure(1, [&](const std::size_t)
+    {
+        for(std::size_t i = 0; i < samples; ++i)
+        {
+            const float v = goblib::easing::inOutSinusoidal<float>(static_cast<float>(frame[i]) / (frames - 1));
+            out[i] = static_cast<std::uint8_t>(std::pow(v, 2.2f) * 255.0f + 0.5f);
+        }
+        keep(out[0]);
+    }) / samples;
+    auto fo = measure(1, [&](const std::size_t)
+    {
+        for(std::size_t i = 0; i < samples; ++i)
+        {
+            outf[i] = goblib::easing::inOutSinusoidal<float>(static_cast<float>(frame[i]) / (frames - 1));
+        }
+        keep(outf[0]);
+    }) / samples;
+    auto t = measure(1, [&](const std::size_t)
+    {
+        fade::transform(frame.data(), out.data(), samples);
+        keep(out[0]);
+    }) / samples;
+    std::printf("## LED brightness (ns/LED, %zu LEDs)\n", samples);
+    std::printf("%-26s %10.2f\n", "float curve only", fo);
+    std::printf("%-26s %10.2f\n", "float curve, pow, quantize", f);
+    std::printf("%-26s %10.2f\n", "gamma_table", t);
+}
+//
+}
@@ -0,0 +1,64 @@
+/*
+  Fixed-point sin, cos and exp2 against floating point (TSC cycles/call).
+  "Q16.16" and "Q1.15" are math::*_q16 / *_q15 (CORDIC, table and correction),
+  "Q30 poly" is the polynomial kernel of the fx curves,
+  "float" and "double" are the standard library.
+  Arguments sweep [-pi, pi] for sin and cos, [-1, 1) for exp2.
+*/
+#include "bench.hpp"
+#include <gob_easing_fixed.hpp>
+#include <cmath>
+#include <cstdint>
+
+namespace
+{
+namespace fx = goblib::easing::fx;
+namespace math = goblib::easing::math;
+
+template<class Fn> double cycles(const std::size_t samples, Fn f)
+{
+    return bench::measure_cycles(samples, f);
+}
+void print(const char* name, const double q16, const double q15, const double poly, const double f, const double d)
+{
+    std::printf("%-6s %10.1f %10.1f %10.1f %10.1f %10.1f\n", name, q16, q15, poly, f, d);
+}
+//
+}
+
+namespace bench
+{
+void kernel_suite(const std::size_t samples)
+{
+    const double pi = goblib::easing::constants::pi<double>();
+    // Argument of i in [0, samples)
+    auto rad = [=](const std::size_t i) { return -pi + 2 * pi * static_cast<double>(i) / static_cast<double>(samples); };
+    auto q16r = [=](const std::size_t i) { return static_cast<fx::q16_t>(rad(i) * 65536); };
+    auto q15h = [=](const std::size_t i) { return static_cast<fx::q15::q15_t>(-32768 + static_cast<std::int32_t>(i * 65536 / samples)); };
+    auto turn = [=](const std::size_t i) { return static_cast<std::uint32_t>(static_cast<std::uint64_t>(i) * 0x100000000ULL / samples); };
+    auto ex = [=](const std::size_t i) { return -1.0 + 2.0 * static_cast<double>(i) / static_cast<double>(samples); };
+
+    std::printf("## fixed-point kernels (TSC cycles/call, %zu samples)\n", samples);
+    std::printf("%-6s %10s %10s %10s %10s %10s\n", "func", "Q16.16", "Q1.15", "Q30 poly", "float", "double");
+    print("sin",
+          cycles(samples, [&](const std::size_t i) { keep(math::sin_q16(q16r(i))); }),
+          cycles(samples, [&](const std::size_t i) { keep(math::sin_q15(q15h(i))); }),
+          cycles(samples, [&](const std::size_t i) { keep(fx::detail::sin_turn(turn(i))); }),
+          cycles(samples, [&](const std::size_t i) { keep(std::sin(static_cast<float>(rad(i)))); }),
+          cycles(samples, [&](const std::size_t i) { keep(std::sin(rad(i))); }));
+    print("cos",
+          cycles(samples, [&](const std::size_t i) { keep(math::cos_q16(q16r(i))); }),
+          cycles(samples, [&](const std::size_t i) { keep(math::cos_q15(q15h(i))); }),
+          cycles(samples, [&](const std::size_t i) { keep(fx::detail::cos_turn(turn(i))); }),
+          cycles(samples, [&](const std::size_t i) { keep(std::cos(static_cast<float>(rad(i)))); }),
+          cycles(samples, [&](const std::size_t i) { keep(std::cos(rad(i))); }));
+    print("exp2",
+          cycles(samples, [&](const std::size_t i) { keep(math::exp2_q16(static_cast<fx::q16_t>(ex(i) * 65536))); }),
+          cycles(samples, [&](const std::size_t i) { keep(math::exp2_q15(static_cast<fx::q15::q15_t>(-32768 + static_cast<std::int32_t>(i * 32768 / samples)))); }),
+          cycles(samples, [&](const std::size_t i) { keep(fx::detail::exp2(static_cast<fx::detail::q30_t>(ex(i) * 1073741824.0))); }),
+          cycles(samples, [&](const std::size_t i) { keep(std::exp2(static_cast<float>(ex(i)))); }),
+          cycles(samples, [&](const std::size_t i) { keep(std::exp2(ex(i))); }));
+    std::printf("# Argument conversion from double is included in all columns\n");
+}
+//
+}
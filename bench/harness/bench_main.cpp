@@ -0,0 +1,27 @@
+/*
+  gob_easing benchmark
+  Usage: program [samples]
+*/
+#include "bench.hpp"
+#include <cstdlib>
+
+int main(int argc, char** argv)
+{
+    std::size_t samples = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    if(samples < 2) { samples = 2; }
+
+#if defined(GOBLIB_EASING_USING_OWN_MATH)
+    std::printf("# Using own math functions\n");
+#endif
+#if defined(__FAST_MATH__)
+    std::printf("# -ffast-math\n");
+#endif
+#if defined(GOBLIB_EASING_INSTRUMENT)
+    std::printf("# Instrumented (iterations per call: <iterations>:<calls>)\n");
+#endif
+    bench::curves_suite(samples);
+    bench::accuracy_suite(samples);
+    bench::fixed_suite(samples);
+    bench::kernel_suite(samples);
+    return 0;
+}
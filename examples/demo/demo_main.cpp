@@ -2,7 +2,7 @@
   gob_easing demo
  */
 #include <M5Unified.h>
-#include <gob_easing.hpp>
+#include <gob_easing_curve.hpp>
 
 // Choose floating point number type
 using fp_type = float;
@@ -10,82 +10,12 @@ using fp_type = float;
 //using fp_type = long double;
 
 using sample_function = void(*)(size_t);
-using ease_function = fp_type(*)(const fp_type);
 
 namespace
 {
 auto& lcd = M5.Display;
 
-ease_function table[] =
-{
-    goblib::easing::linear<fp_type>,
-    goblib::easing::inSinusoidal<fp_type>,
-    goblib::easing::outSinusoidal<fp_type>,
-    goblib::easing::inOutSinusoidal<fp_type>,
-    goblib::easing::inQuadratic<fp_type>,
-    goblib::easing::outQuadratic<fp_type>,
-    goblib::easing::inOutQuadratic<fp_type>,
-    goblib::easing::inCubic<fp_type>,
-    goblib::easing::outCubic<fp_type>,
-    goblib::easing::inOutCubic<fp_type>,
-    goblib::easing::inQuartic<fp_type>,
-    goblib::easing::outQuartic<fp_type>,
-    goblib::easing::inOutQuartic<fp_type>,
-    goblib::easing::inQuintic<fp_type>,
-    goblib::easing::outQuintic<fp_type>,
-    goblib::easing::inOutQuintic<fp_type>,
-    goblib::easing::inExponential<fp_type>,
-    goblib::easing::outExponential<fp_type>,
-    goblib::easing::inOutExponential<fp_type>,
-    goblib::easing::inCircular<fp_type>,
-    goblib::easing::outCircular<fp_type>,
-    goblib::easing::inOutCircular<fp_type>,
-    goblib::easing::inBack<fp_type>,
-    goblib::easing::outBack<fp_type>,
-    goblib::easing::inOutBack<fp_type>,
-    goblib::easing::inElastic<fp_type>,
-    goblib::easing::outElastic<fp_type>,
-    goblib::easing::inOutElastic<fp_type>,
-    goblib::easing::inBounce<fp_type>,
-    goblib::easing::outBounce<fp_type>,
-    goblib::easing::inOutBounce<fp_type>,
-};
-
-const char* name[] =
-{
-    "linear",
-    "inSinusoidal",
-    "outSinusoidal",
-    "inOutSinusoidal",
-    "inQuadratic",
-    "outQuadratic",
-    "inOutQuadratic",
-    "inCubic",
-    "outCubic",
-    "inOutCubic",
-    "inQuartic",
-    "outQuartic",
-    "inOutQuartic",
-    "inQuintic",
-    "outQuintic",
-    "inOutQuintic",
-    "inExponential",
-    "outExponential",
-    "inOutExponential",
-    "inCircular",
-    "outCircular",
-    "inOutCircular",
-    "inBack",
-    "outBack",
-    "inOutBack",
-    "inElastic",
-    "outElastic",
-    "inOutElastic",
-    "inBounce",
-    "outBounce",
-    "inOutBounce",
-};
-constexpr size_t table_size = sizeof(table)/sizeof(table[0]);
+constexpr size_t table_size = goblib::easing::num_curves;
 size_t current_ease = 0;
 
 void drawEaseGraph(const size_t cur)
@@ -108,7 +38,7 @@ void drawEaseGraph(const size_t cur)
     for(int16_t x = 0; x <= wid; ++x)
     {
         fp_type t = (fp_type)x / wid; // Clamp between 0.0 and 1.0
-        auto e = table[cur](t);   // Call ease function
+        auto e = goblib::easing::evaluate(static_cast<goblib::easing::Curve>(cur), t); // Call ease function
         auto y = bottom - hgt * e;
         points.push_back(std::make_pair(left + x, y));
     }
@@ -125,7 +55,7 @@ void drawEaseGraph(const size_t cur)
         lcd.drawLine(p.first.first, p.first.second, p.second.first, p.second.second, TFT_WHITE);
     }
     
-    lcd.drawString(name[cur], 0,0);
+    lcd.drawString(goblib::easing::name(static_cast<goblib::easing::Curve>(cur)), 0,0);
 }
 
 void drawEaseGradient(const size_t cur)
@@ -142,7 +72,7 @@ void drawEaseGradient(const size_t cur)
     for(int16_t y=0;y <= hgt; ++y)
     {
         fp_type t = (fp_type)y / hgt; // Clamp between 0.0 and 1.0
-        auto e = table[cur](t);   // Call ease function
+        auto e = goblib::easing::evaluate(static_cast<goblib::easing::Curve>(cur), t); // Call ease function
 
         auto r = fclr.r + (tclr.r - fclr.r) * e;
         auto g = fclr.g + (tclr.g - fclr.g) * e;
@@ -150,7 +80,7 @@ void drawEaseGradient(const size_t cur)
         
         lcd.drawLine(left, top + y, right, top + y, m5gfx::rgb888_t(r,g,b));
     }
-    lcd.drawString(name[cur], 0,0);
+    lcd.drawString(goblib::easing::name(static_cast<goblib::easing::Curve>(cur)), 0,0);
 }
 
 int32_t counter{};
@@ -165,7 +95,7 @@ void drawEaseAction(const size_t cur)
     if(counter > complete_frames) { counter = 0; lcd.clear(TFT_BLACK); }
     fp_type t = (fp_type)counter / (complete_frames - 30);
     t = std::fmin(std::fmax(t, fp_type{0}), fp_type{1}); // Clamp between 0.0 and 1.0
-    auto e = table[cur](t);   // Call ease function
+    auto e = goblib::easing::evaluate(static_cast<goblib::easing::Curve>(cur), t); // Call ease function
 
     int16_t ox = fx + (tx - fx) * e;
 
@@ -176,7 +106,7 @@ void drawEaseAction(const size_t cur)
     lcd.fillCircle(ox, lcd.height()/2, radius, TFT_ORANGE);
     lcd.drawPixel(ox, lcd.height()/2 + lcd.height()/4, TFT_WHITE);
 
-    lcd.drawString(name[cur], 0,0);
+    lcd.drawString(goblib::easing::name(static_cast<goblib::easing::Curve>(cur)), 0,0);
 
     lgfx::delay(1000/60);
     ++counter;
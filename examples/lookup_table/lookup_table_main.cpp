@@ -56,7 +56,15 @@ constexpr float easeInBounce(int x) { return goblib::easing::inBounce((float)x/(
       easeInBounce(51) // t = 51/(52-1)
   };
  */
+#if defined(__cpp_consteval)
+/*
+  C++20 or later: consteval version.
+  Evaluation at runtime is a compile error, so the table is always baked at compile-time.
+ */
+constexpr auto table = goblib::easing::ce::make_table<goblib::easing::inBounce<float>, numberOfElements>();
+#else
 constexpr auto table = generator<numberOfElements>(easeInBounce);
+#endif
 
 auto& lcd = M5.Display;
 //
@@ -17,7 +17,12 @@
 
 #include <cstdint>
 #include <cmath>
+#include <limits>
 #include <type_traits>
+#if defined(__cpp_consteval)
+#include <array>
+#include <cstddef>
+#endif
 
 // Define if you are forced to use own math functions
 //#define GOBLIB_EASING_USING_FORCE_OWN_MATH
@@ -30,10 +35,58 @@
 #endif
 
 #if GOBLIB_EASING_GCC_VERSION < 40601 || defined(GOBLIB_EASING_USING_FORCE_OWN_MATH)
-#include <limits>
 # define GOBLIB_EASING_USING_OWN_MATH
 #endif
 
+// C++14 relaxed constexpr (local variables and multiple statements) is available?
+#if __cplusplus >= 201402L
+# define GOBLIB_EASING_CONSTEXPR_CPP14
+#endif
+
+// Precision of the whole header (Define one of them, EXACT if not defined)
+//#define GOBLIB_EASING_PRECISION_FAST
+//#define GOBLIB_EASING_PRECISION_BALANCED
+//#define GOBLIB_EASING_PRECISION_EXACT
+
+#if (defined(GOBLIB_EASING_PRECISION_FAST) + defined(GOBLIB_EASING_PRECISION_BALANCED) + defined(GOBLIB_EASING_PRECISION_EXACT)) > 1
+# error "Define only one of GOBLIB_EASING_PRECISION_FAST, BALANCED and EXACT"
+#endif
+
+// Keeps the evaluation order of error compensating expressions under -ffast-math (-fassociative-math)
+#if defined(__has_builtin)
+# if __has_builtin(__builtin_assoc_barrier)
+#  define GOBLIB_EASING_ASSOC_BARRIER(x) __builtin_assoc_barrier(x)
+# endif
+#endif
+#if !defined(GOBLIB_EASING_ASSOC_BARRIER)
+# define GOBLIB_EASING_ASSOC_BARRIER(x) (x)
+#endif
+
+// Define if you compute long double in double (Accepts and returns long double)
+//#define GOBLIB_EASING_LONG_DOUBLE_AS_DOUBLE
+
+// Define if you want to record the number of iterations of own math functions per call (Runtime only)
+//#define GOBLIB_EASING_INSTRUMENT
+
+#if defined(GOBLIB_EASING_INSTRUMENT)
+#include <cstdio>
+// Recording is skipped in constant evaluation, so the functions remain constexpr.
+# if defined(__has_builtin)
+#  if __has_builtin(__builtin_is_constant_evaluated)
+#   define GOBLIB_EASING_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#  endif
+# endif
+# if !defined(GOBLIB_EASING_IS_CONSTANT_EVALUATED) && GOBLIB_EASING_GCC_VERSION >= 90100
+#  define GOBLIB_EASING_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+# endif
+# if !defined(GOBLIB_EASING_IS_CONSTANT_EVALUATED)
+#  error "GOBLIB_EASING_INSTRUMENT requires __builtin_is_constant_evaluated (GCC 9.1 / Clang 9 or later)"
+# endif
+# define GOBLIB_EASING_NOTE(f, n, v) ::goblib::easing::instrument::note((f), (n), (v))
+#else
+# define GOBLIB_EASING_NOTE(f, n, v) (v)
+#endif
+
 /*!
   @namespace goblib
   @brief Top level namespace of mine
@@ -47,6 +100,12 @@ namespace goblib
 namespace easing
 {
 
+/*!
+  @brief Whether T can be used for curves
+  @details Same as std::is_floating_point. Specialize for user-defined floating point types.
+ */
+template<typename T> struct is_floating_point : std::is_floating_point<T> {};
+
 /*!
   @namespace constants
   @brief Constants for easing
@@ -54,7 +113,7 @@ namespace easing
 namespace constants
 {
 ///@cond 0
-template<typename T> constexpr T pi() noexcept { return T{M_PI}; }
+template<typename T> constexpr T pi() noexcept { return T{3.141592653589793238462643383279502884L}; }
 template<typename T> constexpr T half_pi() noexcept { return  pi<T>() * T{0.5}; }
 template<typename T> constexpr T pi2() noexcept { return pi<T>() * T{2.0}; }
 template<typename T> constexpr T e() noexcept { return T{2.71828182845904523536}; }
@@ -66,7 +125,152 @@ template<typename T> constexpr T elastic_factor2() noexcept { return pi2<T>() /
 template<typename T> constexpr T bounce_factor() noexcept { return T{2.75}; }
 template<typename T> constexpr T bounce_factor2() noexcept { return T{7.5625}; }
 ///@endcond
+
+/*!
+  @brief Derived constants of Back, Elastic and Bounce
+  @details Breakpoints, offsets and factors are evaluated once per type,
+  so no division or function call is left in curves even at -O0 or with strict FP settings.
+  Use them in any implementation of the curves (scalar, batch, table) to get the same values.
+ */
+template<typename T> struct derived
+{
+    ///@name Back
+    ///@{
+    static constexpr T back_c1 = back_factor<T>();          //!< c1 = 1.70158
+    static constexpr T back_c3 = back_c1 + T{1};            //!< c3 = c1 + 1
+    static constexpr T back_c2 = back_factor2<T>();         //!< c2 = c1 * 1.525 (InOut)
+    static constexpr T back_c2_1 = back_c2 + T{1};          //!< c2 + 1
+    ///@}
+    ///@name Elastic
+    ///@{
+    static constexpr T elastic_c4 = elastic_factor<T>();    //!< 2pi / 3
+    static constexpr T elastic_c5 = elastic_factor2<T>();   //!< 2pi / 4.5 (InOut)
+    ///@}
+    ///@name Bounce
+    ///@{
+    static constexpr T bounce_n1 = bounce_factor2<T>();     //!< 7.5625
+    static constexpr T bounce_b1 = T{1} / bounce_factor<T>();     //!< Breakpoint 1 / 2.75
+    static constexpr T bounce_b2 = T{2} / bounce_factor<T>();     //!< Breakpoint 2 / 2.75
+    static constexpr T bounce_b3 = T{2.5} / bounce_factor<T>();   //!< Breakpoint 2.5 / 2.75
+    static constexpr T bounce_o1 = T{1.5} / bounce_factor<T>();   //!< Offset 1.5 / 2.75
+    static constexpr T bounce_o2 = T{2.25} / bounce_factor<T>();  //!< Offset 2.25 / 2.75
+    static constexpr T bounce_o3 = T{2.625} / bounce_factor<T>(); //!< Offset 2.625 / 2.75
+    ///@}
+};
+///@cond 0
+// Definitions for ODR-use (e.g. by class types that take const T&) before C++17
+template<typename T> constexpr T derived<T>::back_c1;
+template<typename T> constexpr T derived<T>::back_c3;
+template<typename T> constexpr T derived<T>::back_c2;
+template<typename T> constexpr T derived<T>::back_c2_1;
+template<typename T> constexpr T derived<T>::elastic_c4;
+template<typename T> constexpr T derived<T>::elastic_c5;
+template<typename T> constexpr T derived<T>::bounce_n1;
+template<typename T> constexpr T derived<T>::bounce_b1;
+template<typename T> constexpr T derived<T>::bounce_b2;
+template<typename T> constexpr T derived<T>::bounce_b3;
+template<typename T> constexpr T derived<T>::bounce_o1;
+template<typename T> constexpr T derived<T>::bounce_o2;
+template<typename T> constexpr T derived<T>::bounce_o3;
+///@endcond
+}//
+
+#if defined(GOBLIB_EASING_INSTRUMENT)
+/*!
+  @namespace instrument
+  @brief Iteration histograms of own math functions
+  @note Enabled if GOBLIB_EASING_INSTRUMENT is defined.
+  @note Only runtime calls are recorded. Not thread-safe.
+*/
+namespace instrument
+{
+/// @brief Target functions
+enum class function : std::uint8_t
+{
+    sqrt, //!< Newton steps
+    exp,  //!< Series terms
+    log,  //!< Newton steps
+    sin,  //!< Series terms
+    cos,  //!< Series terms
+    max
+};
+
+/// @brief Histogram of the number of iterations per call
+struct histogram
+{
+    static constexpr std::size_t bins = 64; //!< Last bin counts bins or more
+    std::uint64_t count[bins]; //!< Number of calls per iteration count
+    std::uint64_t calls;       //!< Total calls
+    std::uint64_t total;       //!< Total iterations
+    std::uint32_t max;         //!< Maximum iterations in one call
+};
+
+///@cond 0
+inline histogram* histograms()
+{
+    static histogram h[static_cast<std::size_t>(function::max)]{};
+    return h;
+}
+///@endcond
+
+/// @brief Gets the histogram of the function
+inline const histogram& get(const function f) { return histograms()[static_cast<std::size_t>(f)]; }
+
+/// @brief Gets the name of the function
+inline const char* name(const function f)
+{
+    static const char* tbl[] = { "sqrt", "exp", "log", "sin", "cos" };
+    return f < function::max ? tbl[static_cast<std::size_t>(f)] : "?";
+}
+
+/// @brief Clear all histograms
+inline void reset()
+{
+    for(std::size_t i = 0; i < static_cast<std::size_t>(function::max); ++i) { histograms()[i] = histogram{}; }
+}
+
+/// @brief Record iterations of one call
+inline void record(const function f, const int n)
+{
+    auto& h = histograms()[static_cast<std::size_t>(f)];
+    const std::uint32_t u = n > 0 ? static_cast<std::uint32_t>(n) : 0U;
+    ++h.count[u < histogram::bins ? u : histogram::bins - 1];
+    ++h.calls;
+    h.total += u;
+    h.max = u > h.max ? u : h.max;
+}
+
+/*!
+  @brief Output histograms of called functions
+  @param fp Output destination
+  @param label Header line (nullptr if not needed)
+ */
+inline void dump(std::FILE* fp = stdout, const char* label = nullptr)
+{
+    if(label) { std::fprintf(fp, "# %s\n", label); }
+    for(std::size_t i = 0; i < static_cast<std::size_t>(function::max); ++i)
+    {
+        const auto& h = histograms()[i];
+        if(!h.calls) { continue; }
+        std::fprintf(fp, "%-4s calls:%llu avg:%.2f max:%u |", name(static_cast<function>(i)),
+                     (unsigned long long)h.calls, (double)h.total / h.calls, h.max);
+        for(std::size_t b = 0; b < histogram::bins; ++b)
+        {
+            if(h.count[b]) { std::fprintf(fp, " %zu%s:%llu", b, b + 1 == histogram::bins ? "+" : "", (unsigned long long)h.count[b]); }
+        }
+        std::fprintf(fp, "\n");
+    }
+}
+
+///@cond 0
+template<typename T> inline T record(const function f, const int n, const T v) { record(f, n); return v; }
+template<typename T> constexpr T note(const function f, const int n, const T v)
+{
+    return GOBLIB_EASING_IS_CONSTANT_EVALUATED() ? v : record(f, n, v);
+}
+///@endcond
 }//
+#endif
 
 /*!
   @namespace math
@@ -83,20 +287,226 @@ template<typename T> constexpr bool equal_fp(const T x, const T y)
     return abs(x - y) <= std::numeric_limits<T>::epsilon();
 }
 
+constexpr long double pi_ld = 3.141592653589793238462643383279502884L;
+constexpr long double ln2_ld = 0.693147180559945309417232121458176568L;
+
+template<typename T> constexpr bool is_single() { return std::numeric_limits<T>::digits <= 24; }
+
+// Integer part towards negative infinity (Range of argument is the one used in easing)
+template<typename T> constexpr std::int32_t floor_int(const T x)
+{
+    return static_cast<std::int32_t>(x) - (x < static_cast<T>(static_cast<std::int32_t>(x)) ? 1 : 0);
+}
+template<typename T> constexpr std::int32_t round_int(const T x) { return floor_int(x + T{0.5}); }
+
+// 2^n
+template<typename T> constexpr T square(const T x) { return x * x; }
+template<typename T> constexpr T pow2i(const std::int32_t n)
+{
+    return n < 0 ? T{1} / pow2i<T>(-n) :
+            n == 0 ? T{1} :
+            (n & 1) ? T{2} * pow2i<T>(n - 1) : square(pow2i<T>(n / 2));
+}
+
+// Cody-Waite reduction r = x - k * c (c = pi/2, ln2)
+// The lower 8 bits of hi are zero, so k * hi is exact if |k| < 256.
+// Static members are evaluated once per type, not on every call in constant evaluation.
+template<typename T> struct cw_scale
+{
+    static constexpr long double value = pow2i<long double>(std::numeric_limits<T>::digits - 8);
+};
+template<typename T> constexpr long double cw_hi(const long double c)
+{
+    return static_cast<long double>(static_cast<long long>(c * cw_scale<T>::value + 0.5L)) / cw_scale<T>::value;
+}
+template<typename T> struct half_pi_cw
+{
+    static constexpr T hi = static_cast<T>(cw_hi<T>(pi_ld * 0.5L));
+    static constexpr T lo = static_cast<T>(pi_ld * 0.5L - cw_hi<T>(pi_ld * 0.5L));
+};
+template<typename T> struct ln2_cw
+{
+    static constexpr T hi = static_cast<T>(cw_hi<T>(ln2_ld));
+    static constexpr T lo = static_cast<T>(ln2_ld - cw_hi<T>(ln2_ld));
+};
+template<typename T> constexpr T reduce_half_pi(const T x, const std::int32_t k)
+{
+    return GOBLIB_EASING_ASSOC_BARRIER(x - static_cast<T>(k) * half_pi_cw<T>::hi) - static_cast<T>(k) * half_pi_cw<T>::lo;
+}
+
+// Taylor series of N terms in Horner form
+// sin : r * (1 - r^2/(2*3) * (1 - r^2/(4*5) * (...)))  cos : 1 - r^2/(1*2) * (1 - r^2/(3*4) * (...))
+template<typename T, unsigned N, unsigned K, unsigned O> struct horner_sincos
+{
+    static constexpr T value(const T r2)
+    {
+        return T{1} - r2 * (T{1} / static_cast<T>((2 * K - O) * (2 * K + 1 - O))) * horner_sincos<T, N, K + 1, O>::value(r2);
+    }
+};
+template<typename T, unsigned N, unsigned O> struct horner_sincos<T, N, N, O>
+{
+    static constexpr T value(const T) { return T{1}; }
+};
+// sin(r + q * pi/2)
+template<unsigned N, typename T> constexpr T sin_quadrant_n(const T r, const std::int32_t q)
+{
+    return ((q & 2) ? T{-1} : T{1}) *
+            ((q & 1) ? horner_sincos<T, N, 1, 1>::value(r * r) : r * horner_sincos<T, N, 1, 0>::value(r * r));
+}
+template<unsigned N, typename T> constexpr T sin_k_n(const T x, const std::int32_t k, const std::int32_t shift)
+{
+    return sin_quadrant_n<N>(reduce_half_pi(x, k), (k + shift) & 3);
+}
+template<typename T> constexpr std::int32_t quadrant(const T x) { return round_int(x * static_cast<T>(2 / pi_ld)); }
+///@endcond
+
+/*!
+  @brief sin by N terms of Taylor series after range reduction to [-pi/4, pi/4]
+  @details The cost is linear in N and does not depend on the argument, so it is suitable for compile-time tables.
+  Error is about (pi/4)^(2N) / (2N)! (N = 4: 4e-6, N = 5: 3e-8, N = 8: 1e-15, N = 9: 2e-18)
+  @tparam N Number of terms (1 or more)
+  @note Argument must be in the range where k * pi/2 is exact (|x| < about 400)
+ */
+template<unsigned N, typename T> constexpr T sin_n(const T x)
+{
+    static_assert(N > 0, "N must be 1 or more");
+    static_assert(std::is_floating_point<T>::value, "x must be floating point number");
+    return sin_k_n<N>(x, quadrant(x), 0);
+}
+
+/*!
+  @brief cos by N terms of Taylor series after range reduction to [-pi/4, pi/4]
+  @tparam N Number of terms (1 or more)
+  @sa sin_n
+ */
+template<unsigned N, typename T> constexpr T cos_n(const T x)
+{
+    static_assert(N > 0, "N must be 1 or more");
+    static_assert(std::is_floating_point<T>::value, "x must be floating point number");
+    return sin_k_n<N>(x, quadrant(x), 1);
+}
+///@cond 0
+
 #if defined(GOBLIB_EASING_USING_OWN_MATH)
 # pragma message "Using uniquely implemented arithmetic functions"
 
-// sqrt(fp)
-template<typename T> constexpr T sqrt_impl(const T x, const T curr, const T prev)
+// Upper limits of iterations
+// Convergence tests may never hold for NaN, infinity or under -ffast-math, so iterations are capped.
+constexpr int series_limit = 128; // Terms of exp, sin and cos series
+constexpr int newton_limit = 64;  // Newton steps of log
+// Newton steps of sqrt (Halving from x to sqrt(x) takes up to max_exponent / 2 steps)
+template<typename T> constexpr int sqrt_limit() { return std::numeric_limits<T>::max_exponent / 2 + newton_limit; }
+
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+// Iterative bodies (C++14)
+// A recursive call chain is a distinct constant evaluation per level, which makes compile memory balloon
+template<typename T> constexpr T sqrt_k(const T x)
 {
-    static_assert(std::is_arithmetic<T>::value, "x must be arithmetic type");
-    return equal_fp(curr, prev) ? curr : sqrt_impl(x, T{0.5} * (curr + x / curr), curr);
+    T curr = x, prev{0};
+    int n = 0;
+    while(!equal_fp(curr, prev) && n < sqrt_limit<T>()) { prev = curr; curr = T{0.5} * (curr + x / curr); ++n; }
+    return GOBLIB_EASING_NOTE(instrument::function::sqrt, n, curr);
+}
+
+template<typename T> constexpr T exp_k(const T x)
+{
+    T sum{1}, n{1}, t = x;
+    int i = 2;
+    while(!equal_fp(sum, sum + t / n) && i < series_limit) { sum += t / n; n *= i; ++i; t *= x; }
+    return GOBLIB_EASING_NOTE(instrument::function::exp, i - 1, sum);
+}
+
+template<typename T> constexpr T log_iter(const T x, const T y)
+{
+    const T e = exp_k(y);
+    return y + T{2} * (x - e) / (x + e);
+}
+template<typename T> constexpr T log_k(const T x, T y)
+{
+    T next = log_iter(x, y);
+    int n = 0;
+    while(!equal_fp(y, next) && n < newton_limit) { y = next; next = log_iter(x, y); ++n; }
+    return GOBLIB_EASING_NOTE(instrument::function::log, n, y);
+}
+
+// i is even for sin and odd for cos
+template<typename T> constexpr T sincos_k(const T x, T sum, T n, int i, T t)
+{
+    const T x2 = x * x;
+    int s = -1;
+    while(!equal_fp(sum, sum + t * s / n) && i < series_limit) { sum += t * s / n; n = n * i * (i + 1); i += 2; s = -s; t *= x2; }
+    return GOBLIB_EASING_NOTE((i & 1) ? instrument::function::cos : instrument::function::sin, (i - 1) / 2, sum);
 }
+#else
+// Recursive bodies (C++11)
+template<typename T> constexpr T sqrt_impl(const T x, const T curr, const T prev, const int n)
+{
+    return (equal_fp(curr, prev) || n >= sqrt_limit<T>()) ? GOBLIB_EASING_NOTE(instrument::function::sqrt, n, curr)
+            : sqrt_impl(x, T{0.5} * (curr + x / curr), curr, n + 1);
+}
+template<typename T> constexpr T sqrt_k(const T x) { return sqrt_impl(x, x, T{0}, 0); }
+
+template<typename T> constexpr T exp_impl(T x, T sum, T n, int i, T t)
+{
+    return (equal_fp(sum, sum + t/n) || i >= series_limit) ? GOBLIB_EASING_NOTE(instrument::function::exp, i - 1, sum)
+            : exp_impl(x, sum + t/n, n * i, i+1, t * x);
+}
+template<typename T> constexpr T exp_k(const T x) { return exp_impl(x, T{1}, T{1}, 2, x); }
+
+template<typename T> constexpr T log_iter(const T x, const T y)
+{
+    return y + T{2} * (x - exp_k(y)) / (x + exp_k(y));
+}
+template<typename T> constexpr T log_impl(T x, T y, const int n)
+{
+    return (equal_fp(y, log_iter(x, y)) || n >= newton_limit) ? GOBLIB_EASING_NOTE(instrument::function::log, n, y)
+            : log_impl(x, log_iter(x, y), n + 1);
+}
+template<typename T> constexpr T log_k(const T x, const T y) { return log_impl(x, y, 0); }
+
+template<typename T> constexpr T sincos_impl(T x, T sum, T n, int i, int s, T t)
+{
+    // i is even for sin and odd for cos
+    return (equal_fp(sum ,sum + t*s/n) || i >= series_limit) ?
+            GOBLIB_EASING_NOTE((i & 1) ? instrument::function::cos : instrument::function::sin, (i - 1) / 2, sum) :
+            sincos_impl(x, sum + t*s/n, n*i*(i+1), i+2, -s, t*x*x);
+}
+template<typename T> constexpr T sincos_k(const T x, const T sum, const T n, const int i, const T t)
+{
+    return sincos_impl(x, sum, n, i, -1, t);
+}
+#endif
+
+// sin(r + q * pi/2)
+template<typename T> constexpr T sin_quadrant_k(const T r, const std::int32_t q)
+{
+    return ((q & 2) ? T{-1} : T{1}) *
+            ((q & 1) ? sincos_k(r, T{1}, T{2}, 3, r * r) : sincos_k(r, r, T{6}, 4, r * r * r));
+}
+// Reduce to [-pi/4, pi/4] if k * pi/2 is exact, otherwise use the series as is
+template<typename T> constexpr T sin_shift_k(const T x, const std::int32_t shift)
+{
+    return (abs(x) < static_cast<T>(pi_ld * 128))
+            ? sin_quadrant_k(reduce_half_pi(x, quadrant(x)), (quadrant(x) + shift) & 3)
+            : sin_quadrant_k(x, shift);
+}
+
+// exp(k * ln2 + r) = 2^k * exp(r), |r| <= ln2/2
+template<typename T> constexpr T exp_shift_k(const T x, const std::int32_t k)
+{
+    return pow2i<T>(k) * exp_k(GOBLIB_EASING_ASSOC_BARRIER(x - static_cast<T>(k) * ln2_cw<T>::hi) - static_cast<T>(k) * ln2_cw<T>::lo);
+}
+template<typename T> constexpr T exp_reduce_k(const T x)
+{
+    return (abs(x) < static_cast<T>(ln2_ld * 128)) ? exp_shift_k(x, round_int(x / static_cast<T>(ln2_ld))) : exp_k(x);
+}
+
+// sqrt(fp)
 template<typename T> constexpr T sqrt(const T x)
 {
     static_assert(std::is_arithmetic<T>::value, "x must be arithmetic type");
     return (x >= T{0} && x < std::numeric_limits<T>::infinity())
-            ? sqrt_impl(x, x, T{0})
+            ? sqrt_k(x)
             : (x < 0) ? std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::infinity();
 }
 
@@ -108,28 +518,17 @@ template<typename T> constexpr T factorial(T n)
 }
 
 // exp(fp)
-template <typename T> constexpr T exp_impl(T x, T sum, T n, int i, T t)
-{
-    static_assert(std::is_arithmetic<T>::value, "x must be arithmetic type");
-    return equal_fp(sum, sum + t/n) ? sum : exp_impl(x, sum + t/n, n * i, i+1, t * x);
-}
 template <typename T> constexpr T exp(T x)
 {
     static_assert(std::is_floating_point<T>::value, "x must be floating point number");
-    return exp_impl(x, T{1}, T{1}, 2, x);
+    return exp_reduce_k(x);
 }
 
 // log(fp,fp)
-template <typename T> constexpr T log_iter(T x, T y)
-{
-    static_assert(std::is_arithmetic<T>::value, "x must be arithmetic type");
-    return y + T{2} * (x - exp(y)) / (x + exp(y));
-}
-
 template <typename T> constexpr T log(T x, T y)
 {
-    static_assert(std::is_arithmetic<T>::value, "x must be arithmetic type");
-    return equal_fp(y, log_iter(x, y)) ? y : log(x, log_iter(x, y));
+    static_assert(std::is_floating_point<T>::value, "x must be floating point number");
+    return log_k(x, y);
 }
 
 // pow(fp, integer) pow(fp, fp)
@@ -145,30 +544,26 @@ constexpr T pow(const T x, U const y)
             T{1} / pow(x, -y);
 }
 
+// log(2) is a constant, so 2^y (used by curves) needs no Newton iteration
 template <typename T,
           typename std::enable_if< std::is_floating_point<T>::value, std::nullptr_t>::type = nullptr>
 constexpr T pow(const T x, const T y)
 {
     static_assert(std::is_arithmetic<T>::value, "x must be arithmetic type");
     return (y == std::numeric_limits<T>::infinity()) ? std::numeric_limits<T>::infinity() :
-            (y == -std::numeric_limits<T>::infinity()) ? T{0} : exp(log(x, T{constants::e<T>()}) * y);
-}
-
-// sin(fp)
-template <typename T> constexpr T sincos_impl(T x, T sum, T n, int i, int s, T t)
-{
-    return equal_fp(sum ,sum + t*s/n) ? sum :
-            sincos_impl(x, sum + t*s/n, n*i*(i+1), i+2, -s, t*x*x);
+            (y == -std::numeric_limits<T>::infinity()) ? T{0} :
+            exp_reduce_k((x == T{2} ? static_cast<T>(ln2_ld) : log_k(x, constants::e<T>())) * y);
 }
 
+// sin(fp) cos(fp)
 template <typename T> constexpr T sin(const T x)
 {
-    return sincos_impl(x, x, T{6}, 4, -1, x*x*x);
+    return sin_shift_k(x, 0);
 }
 
 template <typename T> constexpr T cos(const T x)
 {
-    return sincos_impl(x, T{1}, T{2}, 3, -1, x*x);
+    return sin_shift_k(x, 1);
 }
 
 #else
@@ -184,300 +579,851 @@ template<typename T> constexpr T cos(const T x) { return std::cos(x); }
 ///@endcond
 }//
 
+/*!
+  @namespace precision
+  @brief Accuracy-vs-speed policies for the arithmetic used by curves
+  @details The policy is the second template argument of each curve.
+  The default policy is selected by GOBLIB_EASING_PRECISION_FAST, BALANCED or EXACT (EXACT if not defined).
+  |Policy|sin, cos, exp2|sqrt|
+  |---|---|---|
+  |exact|math::sin, math::cos, math::pow (libm or own math)|math::sqrt|
+  |balanced|Range reduction and polynomial tuned to the precision of the type|math::sqrt|
+  |fast|Lookup table and linear interpolation (error about 1e-4)|math::sqrt|
+  @note Linear, polynomial, Back and Bounce curves are the same in every policy.
+  @note All policies are constexpr.
+*/
+namespace precision
+{
+///@cond 0
+namespace detail
+{
+// Taylor polynomial of e^y on [-ln2/2, ln2/2]
+template<typename T> constexpr T exp_poly(const T y)
+{
+    return math::is_single<T>() ?
+            T{1} + y * (T{1} + y * (T{0.5} + y * (T{1.0/6} + y * (T{1.0/24} + y * (T{1.0/120} + y * T{1.0/720}))))) :
+            T{1} + y * (T{1} + y * (T{0.5} + y * (T{1.0/6} + y * (T{1.0/24} + y * (T{1.0/120} + y * (T{1.0/720}
+            + y * (T{1.0/5040} + y * (T{1.0/40320} + y * (T{1.0/362880} + y * (T{1.0/3628800} + y * T{1.0/39916800}))))))))));
+}
+template<typename T> constexpr T exp2_k(const T x, const std::int32_t k)
+{
+    return math::pow2i<T>(k) * exp_poly((x - static_cast<T>(k)) * static_cast<T>(math::ln2_ld));
+}
+
+// Lookup tables
+template<typename D = void> struct lut
+{
+    static constexpr std::int32_t sin_size = 256; // One cycle
+    static constexpr float sin[sin_size + 1] =
+    {
+        0.0f, 0.0245412285f, 0.0490676743f, 0.0735645636f, 0.0980171403f, 0.122410675f, 0.146730474f, 0.170961889f,
+        0.195090322f, 0.21910124f, 0.24298018f, 0.266712757f, 0.290284677f, 0.31368174f, 0.336889853f, 0.359895037f,
+        0.382683432f, 0.405241314f, 0.427555093f, 0.44961133f, 0.471396737f, 0.492898192f, 0.514102744f, 0.53499762f,
+        0.555570233f, 0.575808191f, 0.595699304f, 0.615231591f, 0.634393284f, 0.653172843f, 0.671558955f, 0.689540545f,
+        0.707106781f, 0.724247083f, 0.740951125f, 0.757208847f, 0.773010453f, 0.788346428f, 0.803207531f, 0.817584813f,
+        0.831469612f, 0.844853565f, 0.85772861f, 0.870086991f, 0.881921264f, 0.893224301f, 0.903989293f, 0.914209756f,
+        0.923879533f, 0.932992799f, 0.941544065f, 0.949528181f, 0.956940336f, 0.963776066f, 0.970031253f, 0.97570213f,
+        0.98078528f, 0.985277642f, 0.98917651f, 0.992479535f, 0.995184727f, 0.997290457f, 0.998795456f, 0.999698819f,
+        1.0f, 0.999698819f, 0.998795456f, 0.997290457f, 0.995184727f, 0.992479535f, 0.98917651f, 0.985277642f,
+        0.98078528f, 0.97570213f, 0.970031253f, 0.963776066f, 0.956940336f, 0.949528181f, 0.941544065f, 0.932992799f,
+        0.923879533f, 0.914209756f, 0.903989293f, 0.893224301f, 0.881921264f, 0.870086991f, 0.85772861f, 0.844853565f,
+        0.831469612f, 0.817584813f, 0.803207531f, 0.788346428f, 0.773010453f, 0.757208847f, 0.740951125f, 0.724247083f,
+        0.707106781f, 0.689540545f, 0.671558955f, 0.653172843f, 0.634393284f, 0.615231591f, 0.595699304f, 0.575808191f,
+        0.555570233f, 0.53499762f, 0.514102744f, 0.492898192f, 0.471396737f, 0.44961133f, 0.427555093f, 0.405241314f,
+        0.382683432f, 0.359895037f, 0.336889853f, 0.31368174f, 0.290284677f, 0.266712757f, 0.24298018f, 0.21910124f,
+        0.195090322f, 0.170961889f, 0.146730474f, 0.122410675f, 0.0980171403f, 0.0735645636f, 0.0490676743f, 0.0245412285f,
+        0.0f, -0.0245412285f, -0.0490676743f, -0.0735645636f, -0.0980171403f, -0.122410675f, -0.146730474f, -0.170961889f,
+        -0.195090322f, -0.21910124f, -0.24298018f, -0.266712757f, -0.290284677f, -0.31368174f, -0.336889853f, -0.359895037f,
+        -0.382683432f, -0.405241314f, -0.427555093f, -0.44961133f, -0.471396737f, -0.492898192f, -0.514102744f, -0.53499762f,
+        -0.555570233f, -0.575808191f, -0.595699304f, -0.615231591f, -0.634393284f, -0.653172843f, -0.671558955f, -0.689540545f,
+        -0.707106781f, -0.724247083f, -0.740951125f, -0.757208847f, -0.773010453f, -0.788346428f, -0.803207531f, -0.817584813f,
+        -0.831469612f, -0.844853565f, -0.85772861f, -0.870086991f, -0.881921264f, -0.893224301f, -0.903989293f, -0.914209756f,
+        -0.923879533f, -0.932992799f, -0.941544065f, -0.949528181f, -0.956940336f, -0.963776066f, -0.970031253f, -0.97570213f,
+        -0.98078528f, -0.985277642f, -0.98917651f, -0.992479535f, -0.995184727f, -0.997290457f, -0.998795456f, -0.999698819f,
+        -1.0f, -0.999698819f, -0.998795456f, -0.997290457f, -0.995184727f, -0.992479535f, -0.98917651f, -0.985277642f,
+        -0.98078528f, -0.97570213f, -0.970031253f, -0.963776066f, -0.956940336f, -0.949528181f, -0.941544065f, -0.932992799f,
+        -0.923879533f, -0.914209756f, -0.903989293f, -0.893224301f, -0.881921264f, -0.870086991f, -0.85772861f, -0.844853565f,
+        -0.831469612f, -0.817584813f, -0.803207531f, -0.788346428f, -0.773010453f, -0.757208847f, -0.740951125f, -0.724247083f,
+        -0.707106781f, -0.689540545f, -0.671558955f, -0.653172843f, -0.634393284f, -0.615231591f, -0.595699304f, -0.575808191f,
+        -0.555570233f, -0.53499762f, -0.514102744f, -0.492898192f, -0.471396737f, -0.44961133f, -0.427555093f, -0.405241314f,
+        -0.382683432f, -0.359895037f, -0.336889853f, -0.31368174f, -0.290284677f, -0.266712757f, -0.24298018f, -0.21910124f,
+        -0.195090322f, -0.170961889f, -0.146730474f, -0.122410675f, -0.0980171403f, -0.0735645636f, -0.0490676743f, -0.0245412285f,
+        0.0f,
+    };
+    static constexpr std::int32_t exp2_size = 32; // 2^[0.0 ~ 1.0]
+    static constexpr float exp2[exp2_size + 1] =
+    {
+        1.0f, 1.02189715f, 1.04427378f, 1.0671404f, 1.09050773f, 1.11438674f, 1.13878863f, 1.16372486f,
+        1.18920712f, 1.21524736f, 1.24185781f, 1.26905096f, 1.29683955f, 1.32523664f, 1.35425555f, 1.38390988f,
+        1.41421356f, 1.44518081f, 1.47682615f, 1.50916443f, 1.54221083f, 1.57598085f, 1.61049033f, 1.64575548f,
+        1.68179283f, 1.7186193f, 1.75625216f, 1.79470908f, 1.83400809f, 1.87416763f, 1.91520656f, 1.95714412f,
+        2.0f,
+    };
+};
+template<typename D> constexpr float lut<D>::sin[lut<D>::sin_size + 1];
+template<typename D> constexpr float lut<D>::exp2[lut<D>::exp2_size + 1];
+
+template<typename T> constexpr T lerp(const T a, const T b, const T f) { return a + (b - a) * f; }
+// p : phase [0 ~ sin_size) is one cycle
+template<typename T> constexpr T sin_lut_i(const T p, const std::int32_t i)
+{
+    return lerp(static_cast<T>(lut<>::sin[i & (lut<>::sin_size - 1)]),
+                static_cast<T>(lut<>::sin[(i & (lut<>::sin_size - 1)) + 1]), p - static_cast<T>(i));
+}
+template<typename T> constexpr T sin_lut(const T p) { return sin_lut_i(p, math::floor_int(p)); }
+template<typename T> constexpr T phase(const T x) { return x * static_cast<T>(lut<>::sin_size / (2 * math::pi_ld)); }
+// f : fraction [0 ~ exp2_size] (exp2_size if x is a tiny negative number, since x - n rounds to 1)
+template<typename T> constexpr T exp2_lut_i(const std::int32_t n, const T f, const std::int32_t i)
+{
+    return math::pow2i<T>(n) * lerp(static_cast<T>(lut<>::exp2[i]), static_cast<T>(lut<>::exp2[i + 1]), f - static_cast<T>(i));
+}
+template<typename T> constexpr T exp2_lut_f(const std::int32_t n, const T f)
+{
+    return exp2_lut_i(n, f, f < static_cast<T>(lut<>::exp2_size) ? math::floor_int(f) : lut<>::exp2_size - 1);
+}
+template<typename T> constexpr T exp2_lut(const T x, const std::int32_t n)
+{
+    return exp2_lut_f(n, (x - static_cast<T>(n)) * lut<>::exp2_size);
+}
+//
+}
+///@endcond
+
+/// @brief Reference implementation (libm or own math functions)
+struct exact
+{
+    template<typename T> using compute = T; //!< Type to compute T
+    template<typename T> static constexpr T sin(const T x) { return math::sin(x); }
+    template<typename T> static constexpr T cos(const T x) { return math::cos(x); }
+    template<typename T> static constexpr T exp2(const T x) { return math::pow(T{2}, x); }
+    template<typename T> static constexpr T sqrt(const T x) { return math::sqrt(x); }
+};
+
+/// @brief Polynomial approximations (float: about 1e-7, double: about 1e-15)
+struct balanced
+{
+    template<typename T> using compute = T; //!< Type to compute T
+    /// @brief Number of terms of sin/cos
+    template<typename T> static constexpr unsigned terms() { return math::is_single<T>() ? 5 : 9; }
+    template<typename T> static constexpr T sin(const T x) { return math::sin_n<terms<T>()>(x); }
+    template<typename T> static constexpr T cos(const T x) { return math::cos_n<terms<T>()>(x); }
+    template<typename T> static constexpr T exp2(const T x) { return detail::exp2_k(x, math::round_int(x)); }
+    template<typename T> static constexpr T sqrt(const T x) { return math::sqrt(x); }
+};
+
+/// @brief Lookup tables with linear interpolation (about 1e-4)
+struct fast
+{
+    template<typename T> using compute = T; //!< Type to compute T
+    template<typename T> static constexpr T sin(const T x) { return detail::sin_lut(detail::phase(x)); }
+    template<typename T> static constexpr T cos(const T x)
+    {
+        return detail::sin_lut(detail::phase(x) + static_cast<T>(detail::lut<>::sin_size / 4));
+    }
+    template<typename T> static constexpr T exp2(const T x) { return detail::exp2_lut(x, math::floor_int(x)); }
+    template<typename T> static constexpr T sqrt(const T x) { return math::sqrt(x); }
+};
+
+/*!
+  @brief Compute long double in double, accepts and returns long double
+  @details x87 instructions for long double on x86-64 are much slower than SSE and prevent vectorization.
+  @tparam P Base policy
+ */
+template<class P> struct long_double_as_double : P
+{
+    template<typename T> using compute =
+            typename std::conditional<std::is_same<T, long double>::value, double, T>::type; //!< Type to compute T
+};
+
+/*!
+  @brief Compute any T in C, accepts and returns T
+  @details e.g. compute_in<double_double> computes float table entries in double-double.
+  @tparam C Type to compute
+  @tparam P Base policy
+ */
+template<typename C, class P> struct compute_in : P
+{
+    template<typename T> using compute = C; //!< Type to compute T
+};
+
+///@cond 0
+#if defined(GOBLIB_EASING_PRECISION_FAST)
+using base_policy = fast;
+#elif defined(GOBLIB_EASING_PRECISION_BALANCED)
+using base_policy = balanced;
+#else
+using base_policy = exact;
+#endif
+///@endcond
+
+/// @brief Default policy of curves
+#if defined(GOBLIB_EASING_LONG_DOUBLE_AS_DOUBLE)
+using default_policy = long_double_as_double<base_policy>;
+#else
+using default_policy = base_policy;
+#endif
+
+/// @brief Type to compute T in policy P
+template<typename T, class P> using compute_type = typename P::template compute<T>;
+}//
+
+///@cond 0
+namespace detail
+{
+// Implementation of curves. T is the type to compute.
+template<typename T, class P> constexpr T linear(const T t)
+{
+    return t;
+}
+
+template<typename T, class P> constexpr T inSinusoidal(const T t)
+{
+    return -P::cos(t * constants::half_pi<T>()) + T{1};
+}
+
+template<typename T, class P> constexpr T outSinusoidal(const T t)
+{
+    return P::sin(t * constants::half_pi<T>());
+}
+
+template<typename T, class P> constexpr T inOutSinusoidal(const T t)
+{
+    return -T{0.5} * (P::cos(t * constants::pi<T>()) - T{1});
+}
+
+template<typename T, class P> constexpr T inQuadratic(const T t)
+{
+    return t * t;
+}
+
+template<typename T, class P> constexpr T outQuadratic(const T t)
+{
+    return -t * (t - T{2.0});
+}
+
+template<typename T, class P> constexpr T inOutQuadratic(const T t)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T t2 = t * T{2};
+    if(t2 < T{1}) { return T{0.5} * t2 * t2; }
+    const T u = t2 - T{2};
+    return T{1} - T{0.5} * u * u;
+#else
+    return ((t * T{2}) < T{1.0}) ?
+            (T{0.5} * (t * T{2}) * (t * T{2})) :
+            -T{0.5} * (((t * T{2}) - T{1}) * (((t * T{2}) - T{1}) - T{2}) - T{1});
+#endif
+}
+
+template<typename T, class P> constexpr T inCubic(const T t)
+{
+    return t * t * t;
+}
+
+template<typename T, class P> constexpr T outCubic(const T t)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T u = t - T{1};
+    return u * u * u + T{1};
+#else
+    return ((t - T{1}) * (t - T{1}) * (t - T{1}) + T{1});
+#endif
+}
+
+template<typename T, class P> constexpr T inOutCubic(const T t)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T t2 = t * T{2};
+    if(t2 < T{1}) { return T{0.5} * t2 * t2 * t2; }
+    const T u = t2 - T{2};
+    return T{0.5} * (u * u * u + T{2});
+#else
+    return (t * T{2}) < T{1} ?
+            T{0.5} * (t * T{2}) * (t * T{2} ) * (t * T{2}) :
+            T{0.5} * ((t * T{2} - T{2}) * (t * T{2} - T{2}) * (t * T{2} - T{2}) + T{2});
+#endif
+}
+
+template<typename T, class P> constexpr T inQuartic(const T t)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T t2 = t * t;
+    return t2 * t2;
+#else
+    return t * t * t * t;
+#endif
+}
+
+template<typename T, class P> constexpr T outQuartic(const T t)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T u = t - T{1};
+    const T u2 = u * u;
+    return T{1} - u2 * u2;
+#else
+    return -((t - T{1}) * (t - T{1}) * (t - T{1}) * (t - T{1}) - T{1});
+#endif
+}
+
+template<typename T, class P> constexpr T inOutQuartic(const T t)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T t2 = t * T{2};
+    const T u = (t2 < T{1}) ? t2 : t2 - T{2};
+    const T u2 = u * u;
+    return (t2 < T{1}) ? T{0.5} * u2 * u2 : T{1} - T{0.5} * u2 * u2;
+#else
+    return (t * T{2}) < T{1} ?
+            T{0.5} * (t * T{2}) * (t * T{2}) * (t * T{2}) * (t * T{2}) :
+            -T{0.5} * ((t * T{2} - T{2}) * (t * T{2} - T{2}) * (t * T{2} - T{2}) * (t * T{2} - T{2}) - T{2});
+#endif
+}
+
+template<typename T, class P> constexpr T inQuintic(const T t)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T t2 = t * t;
+    return t2 * t2 * t;
+#else
+    return t * t * t * t * t;
+#endif
+}
+
+template<typename T, class P> constexpr T outQuintic(const T t)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T u = t - T{1};
+    const T u2 = u * u;
+    return u2 * u2 * u + T{1};
+#else
+    return ((t - T{1}) * (t - T{1}) * (t - T{1}) * (t - T{1}) * (t - T{1}) + T{1});
+#endif
+}
+
+template<typename T, class P> constexpr T inOutQuintic(const T t)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T t2 = t * T{2};
+    const T u = (t2 < T{1}) ? t2 : t2 - T{2};
+    const T u2 = u * u;
+    return (t2 < T{1}) ? T{0.5} * u2 * u2 * u : T{0.5} * (u2 * u2 * u + T{2});
+#else
+    return (t * T{2}) < T{1} ?
+            T{0.5} * (t * T{2}) * (t * T{2}) * (t * T{2}) * (t * T{2}) * (t * T{2}) :
+            T{0.5} * ((t * T{2} - T{2}) * (t * T{2} - T{2}) * (t * T{2} - T{2}) * (t * T{2} - T{2}) * (t * T{2} - T{2}) + T{2});
+#endif
+}
+
+template<typename T, class P> constexpr T inExponential(const T t)
+{
+    return (t <= T{0}) ? T{0} : P::exp2(T{10} * (t - T{1}));
+}
+
+template<typename T, class P> constexpr T outExponential(const T t)
+{
+    return (t >= T{1}) ? T{1} : -P::exp2(-T{10} * t) + T{1};
+}
+
+template<typename T, class P> constexpr T inOutExponential(const T t)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    if(t <= T{0}) { return T{0}; }
+    if(t >= T{1}) { return T{1}; }
+    const T t2 = t * T{2};
+    const T e = T{10} * (t2 - T{1});
+    return (t2 < T{1}) ? T{0.5} * P::exp2(e) : T{1} - T{0.5} * P::exp2(-e);
+#else
+    return (t <= T{0}) ? T{0} :
+            (t >= T{1}) ? T{1} :
+            (t * T{2}) < T{1} ?
+            T{0.5} * P::exp2(T{10} * (t * T{2} - T{1})) :
+            T{0.5} * (-P::exp2(-T{10} * (t * T{2} - T{1})) + T{2});
+#endif
+}
+
+template<typename T, class P> constexpr T inCircular(const T t)
+{
+    return -(P::sqrt(T{1} - t * t) - T{1});
+}
+
+template<typename T, class P> constexpr T outCircular(const T t)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T u = t - T{1};
+    return P::sqrt(T{1} - u * u);
+#else
+    return P::sqrt(T{1} - (t - T{1}) * (t - T{1}));
+#endif
+}
+
+template<typename T, class P> constexpr T inOutCircular(const T t)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T t2 = t * T{2};
+    const T u = (t2 < T{1}) ? t2 : t2 - T{2};
+    const T s = P::sqrt(T{1} - u * u);
+    return (t2 < T{1}) ? T{0.5} * (T{1} - s) : T{0.5} * (s + T{1});
+#else
+    return (t * T{2}) < T{1} ?
+            -T{0.5} * (P::sqrt(T{1} - (t * T{2}) * (t * T{2})) - T{1}) :
+             T{0.5} * (P::sqrt(T{1} - (t * T{2} - T{2}) * (t * T{2} - T{2})) + T{1});
+#endif
+}
+
+template<typename T, class P> constexpr T inBack(const T t)
+{
+    using K = constants::derived<T>;
+    return t * t * (K::back_c3 * t - K::back_c1);
+}
+
+template<typename T, class P> constexpr T outBack(const T t)
+{
+    using K = constants::derived<T>;
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T u = t - T{1};
+    return u * u * (K::back_c3 * u + K::back_c1) + T{1};
+#else
+    return ((t - T{1})* (t - T{1}) * (K::back_c3 * (t - T{1}) + K::back_c1) + T{1});
+#endif
+}
+
+template<typename T, class P> constexpr T inOutBack(const T t)
+{
+    using K = constants::derived<T>;
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    const T t2 = t * T{2};
+    if(t2 < T{1}) { return T{0.5} * (t2 * t2 * (K::back_c2_1 * t2 - K::back_c2)); }
+    const T u = t2 - T{2};
+    return T{0.5} * (u * u * (K::back_c2_1 * u + K::back_c2) + T{2});
+#else
+    return (t * T{2}) < T{1} ?
+            T{0.5} * ((t * T{2}) * (t * T{2}) * (K::back_c2_1 * (t * T{2}) - K::back_c2) ) :
+    T{0.5} * ((t * T{2} - T{2}) * (t * T{2} - T{2}) * (K::back_c2_1 * (t * T{2} - T{2}) + K::back_c2) + T{2});
+#endif
+}
+
+template<typename T, class P> constexpr T inElastic(const T t)
+{
+    //INF,NaN occurs depending on the value of float in own sin, in that case switch to double.
+#if defined(GOBLIB_EASING_USING_OWN_MATH)
+    using sin_type = typename std::common_type< T, double>::type;
+#else
+    using sin_type = T;
+#endif
+    return (t <= T{0}) ? T{0} :
+            (t >= T{1}) ? T{1} :
+            -P::exp2(T{10} * t - T{10}) * P::sin((sin_type)(t * T{10} - T{10.75}) * constants::derived<T>::elastic_c4);
+}
+
+template<typename T, class P> constexpr T outElastic(const T t)
+{
+#if defined(GOBLIB_EASING_USING_OWN_MATH)
+    using sin_type = typename std::common_type< T, double>::type;
+#else
+    using sin_type = T;
+#endif
+    return (t <= T{0}) ? T{0} :
+            (t >= T{1}) ? T{1} :
+            P::exp2(-T{10} * t) * P::sin((sin_type)(t * T{10} - T{0.75}) * constants::derived<T>::elastic_c4) + T{1};
+}
+
+template<typename T, class P> constexpr T inOutElastic(const T t)
+{
+#if defined(GOBLIB_EASING_USING_OWN_MATH)
+    using sin_type = typename std::common_type< T, double>::type;
+#else
+    using sin_type = T;
+#endif
+    return (t <= T{0}) ? T{0} :
+            ((t >= T{1}) ? T{1} :
+             (t < T{0.5} ?
+            -T{0.5} * (P::exp2(T{20} * t - T{10}) * P::sin((sin_type)(T{20} * t - T{11.125}) * constants::derived<T>::elastic_c5)) :
+             T{0.5} * (P::exp2(-T{20} * t + T{10}) * P::sin((sin_type)(T{20} * t - T{11.125}) * constants::derived<T>::elastic_c5)) + T{1}));
+}
+
+template<typename T, class P> constexpr T outBounce(const T t)
+{
+    using K = constants::derived<T>;
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    if(t < K::bounce_b1) { return K::bounce_n1 * t * t; }
+    if(t < K::bounce_b2) { const T u = t - K::bounce_o1; return K::bounce_n1 * u * u + T{0.75}; }
+    if(t < K::bounce_b3) { const T u = t - K::bounce_o2; return K::bounce_n1 * u * u + T{0.9375}; }
+    const T u = t - K::bounce_o3;
+    return K::bounce_n1 * u * u + T{0.984375};
+#else
+    return t < K::bounce_b1 ? K::bounce_n1 * t * t :
+            t < K::bounce_b2 ? K::bounce_n1 * (t - K::bounce_o1) * (t - K::bounce_o1) + T{0.75} :
+            t < K::bounce_b3 ? K::bounce_n1 * (t - K::bounce_o2) * (t - K::bounce_o2) + T{0.9375} :
+            K::bounce_n1 * (t - K::bounce_o3) * (t - K::bounce_o3) + T{0.984375};
+#endif
+}
+
+template<typename T, class P> constexpr T inBounce(const T t)
+{
+    return T{1} - detail::outBounce<T, P>(T{1} - t);
+}
+
+template<typename T, class P> constexpr T inOutBounce(const T t)
+{
+    return t < T{0.5} ? (T{1} - detail::outBounce<T, P>(T{1} - T{2} * t)) * T{0.5}
+            :  (T{1} + detail::outBounce<T, P>(T{2} * t - T{1})) * T{0.5};
+}
+//
+}
+///@endcond
+
 ///@name Easing behavior
 ///@note Argument t [0.0 ~ 1.0]
-///@warning No range check of values is performed, so check on the side to be passed on.
+///@note Template argument P is the precision policy. See also goblib::easing::precision
+///@warning Only Exponential and Elastic guard their endpoints, by ordered comparisons that also hold under -ffast-math:
+/// inExponential returns 0 for t <= 0, outExponential returns 1 for t >= 1,
+/// inOutExponential and the Elastic curves return 0 for t <= 0 and 1 for t >= 1.
+/// The other curves perform no range check, so pass t in [0, 1].
 ///@{
 
 /// @brief Linear
-template<typename T> constexpr T linear(const T t)
+template<typename T, class P = precision::default_policy> constexpr T linear(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return t;
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::linear<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease in sinusoidal
 /// @sa https://easings.net/#easeInSine
-template<typename T> constexpr T inSinusoidal(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inSinusoidal(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return -math::cos(t * constants::half_pi<T>()) + T{1};
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inSinusoidal<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease out sinusoidal
 /// @sa https://easings.net/#easeOutSine
-template<typename T> constexpr T outSinusoidal(const T t)
+template<typename T, class P = precision::default_policy> constexpr T outSinusoidal(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return math::sin(t * constants::half_pi<T>());
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::outSinusoidal<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease inout sinusoidal
 /// @sa https://easings.net/#easeInOutSine
-template<typename T> constexpr T inOutSinusoidal(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inOutSinusoidal(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return -T{0.5} * (math::cos(t * constants::pi<T>()) - T{1});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inOutSinusoidal<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease in quadratic
 /// @sa https://easings.net/#easeInQuad
-template<typename T> constexpr T inQuadratic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inQuadratic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return t * t;
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inQuadratic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease out quadratic
 /// @sa https://easings.net/#easeOutQuad
-template<typename T> constexpr T outQuadratic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T outQuadratic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return -t * (t - T{2.0});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::outQuadratic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease inout quadratic
 /// @sa https://easings.net/#easeInOutQuad
-template<typename T> constexpr T inOutQuadratic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inOutQuadratic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return ((t * T{2}) < T{1.0}) ?
-            (T{0.5} * (t * T{2}) * (t * T{2})) :
-            -T{0.5} * (((t * T{2}) - T{1}) * (((t * T{2}) - T{1}) - T{2}) - T{1});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inOutQuadratic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease in cubic
 /// @sa https://easings.net/#easeInCubic
-template<typename T> constexpr T inCubic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inCubic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return t * t * t;
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inCubic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease out cubic
 /// @sa https://easings.net/#easeOutCubic
-template<typename T> constexpr T outCubic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T outCubic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return ((t - T{1}) * (t - T{1}) * (t - T{1}) + T{1});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::outCubic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease inout cubic
 /// @sa https://easings.net/#easeInOutCubic
-template<typename T> constexpr T inOutCubic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inOutCubic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");    
-    return (t * T{2}) < T{1} ?
-            T{0.5} * (t * T{2}) * (t * T{2} ) * (t * T{2}) :
-            T{0.5} * ((t * T{2} - T{2}) * (t * T{2} - T{2}) * (t * T{2} - T{2}) + T{2});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inOutCubic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease in quartic
 /// @sa https://easings.net/#easeInQuart
-template<typename T> constexpr T inQuartic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inQuartic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return t * t * t * t;
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inQuartic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease out quartic
 /// @sa https://easings.net/#easeOutQuart
-template<typename T> constexpr T outQuartic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T outQuartic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return -((t - T{1}) * (t - T{1}) * (t - T{1}) * (t - T{1}) - T{1});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::outQuartic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease inout quartic
 /// @sa https://easings.net/#easeOutQuart
-template<typename T> constexpr T inOutQuartic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inOutQuartic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return (t * T{2}) < T{1} ?
-            T{0.5} * (t * T{2}) * (t * T{2}) * (t * T{2}) * (t * T{2}) :
-            -T{0.5} * ((t * T{2} - T{2}) * (t * T{2} - T{2}) * (t * T{2} - T{2}) * (t * T{2} - T{2}) - T{2});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inOutQuartic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease in quintic
 /// @sa https://easings.net/#easeInQuint
-template<typename T> constexpr T inQuintic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inQuintic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return t * t * t * t * t;
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inQuintic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease out quintic
 /// @sa https://easings.net/#easeOutQuint
-template<typename T> constexpr T outQuintic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T outQuintic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return ((t - T{1}) * (t - T{1}) * (t - T{1}) * (t - T{1}) * (t - T{1}) + T{1});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::outQuintic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease inout quintic
 /// @sa https://easings.net/#easeInOutQuint
-template<typename T> constexpr T inOutQuintic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inOutQuintic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return (t * T{2}) < T{1} ?
-            T{0.5} * (t * T{2}) * (t * T{2}) * (t * T{2}) * (t * T{2}) * (t * T{2}) :
-            T{0.5} * ((t * T{2} - T{2}) * (t * T{2} - T{2}) * (t * T{2} - T{2}) * (t * T{2} - T{2}) * (t * T{2} - T{2}) + T{2});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inOutQuintic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease in exponential
 /// @sa https://easings.net/#easeInExpo
-template<typename T> constexpr T inExponential(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inExponential(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return math::equal_fp(t, T{0}) ? T{0} : math::pow(T{2}, T{10} * (t - T{1}));
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inExponential<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease out exponential
 /// @sa https://easings.net/#easeOutExpo
-template<typename T> constexpr T outExponential(const T t)
+template<typename T, class P = precision::default_policy> constexpr T outExponential(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return math::equal_fp(t, T{1}) ? T{1} : -math::pow(T{2}, -T{10} * t) + T{1};
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::outExponential<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease inout exponential
 /// @sa https://easings.net/#easeInOutExpo
-template<typename T>constexpr T inOutExponential(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inOutExponential(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return math::equal_fp(t, T{0}) ? T{0} :
-            math::equal_fp(t, T{1}) ? T{1} :
-            (t * T{2}) < T{1} ?
-            T{0.5} * math::pow(T{2}, T{10} * (t * T{2} - T{1})) :
-            T{0.5} * (-math::pow(T{2}, -T{10} * (t * T{2} - T{1})) + T{2});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inOutExponential<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease in circular
 /// @sa https://easings.net/#easeInCirc
-template<typename T> constexpr T inCircular(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inCircular(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return -(math::sqrt(T{1} - t * t) - T{1});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inCircular<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease out circular
 /// @sa https://easings.net/#easeOutCirc
-template<typename T> constexpr T outCircular(const T t)
+template<typename T, class P = precision::default_policy> constexpr T outCircular(const T t)
 {
-    return math::sqrt(T{1} - (t - T{1}) * (t - T{1}));
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::outCircular<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease inout circular
 /// @sa https://easings.net/#easeInOutCirc
-template<typename T> constexpr T inOutCircular(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inOutCircular(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return (t * T{2}) < T{1} ?
-            -T{0.5} * (math::sqrt(T{1} - (t * T{2}) * (t * T{2})) - T{1}) :
-             T{0.5} * (math::sqrt(T{1} - (t * T{2} - T{2}) * (t * T{2} - T{2})) + T{1});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inOutCircular<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease in back
 /// @sa https://easings.net/#easeInBack
-template<typename T> constexpr T inBack(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inBack(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return t * t * ((constants::back_factor<T>() + T{1} ) * t - constants::back_factor<T>());
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inBack<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease out back
 /// @sa https://easings.net/#easeOutBack
-template<typename T> constexpr T outBack(const T t)
+template<typename T, class P = precision::default_policy> constexpr T outBack(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return ((t - T{1})* (t - T{1}) * ((constants::back_factor<T>() + T{1} ) * (t - T{1}) + constants::back_factor<T>()) + T{1});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::outBack<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease inout back
 /// @sa https://easings.net/#easeInOutBack
-template<typename T> constexpr T inOutBack(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inOutBack(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return (t * T{2}) < T{1} ?
-            T{0.5} * ((t * T{2}) * (t * T{2}) * ((constants::back_factor2<T>() + T{1}) * (t * T{2}) - constants::back_factor2<T>()) ) :
-    T{0.5} * ((t * T{2} - T{2}) * (t * T{2} - T{2}) * ((constants::back_factor2<T>() + T{1}) * (t * T{2} - T{2}) + constants::back_factor2<T>()) + T{2});
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inOutBack<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease in elastic
 /// @sa https://easings.net/#easeInElastic
-template<typename T> constexpr T inElastic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inElastic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    //INF,NaN occurs depending on the value of float in own sin, in that case switch to double.
-#if defined(GOBLIB_EASING_USING_OWN_MATH)
-    using sin_type = typename std::common_type< T, double>::type;
-#else
-    using sin_type = T;
-#endif
-    return (t <= T{0}) ? T{0} :
-            (t >= T{1}) ? T{1} :
-            -math::pow(T{2}, T{10} * t - T{10}) * math::sin((sin_type)(t * T{10} - T{10.75}) * constants::elastic_factor<T>());
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inElastic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease out elastic
 /// @sa https://easings.net/#easeOutElastic
-template<typename T> constexpr T outElastic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T outElastic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-#if defined(GOBLIB_EASING_USING_OWN_MATH)
-    using sin_type = typename std::common_type< T, double>::type;
-#else
-    using sin_type = T;
-#endif
-    return (t <= T{0}) ? T{0} :
-            (t >= T{1}) ? T{1} :
-            math::pow(T{2}, -T{10} * t) * math::sin((sin_type)(t * T{10} - T{0.75}) * constants::elastic_factor<T>()) + T{1};
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::outElastic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease inout elastic
 /// @sa https://easings.net/#easeInOutElastic
-template<typename T> constexpr T inOutElastic(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inOutElastic(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-#if defined(GOBLIB_EASING_USING_OWN_MATH)
-    using sin_type = typename std::common_type< T, double>::type;
-#else
-    using sin_type = T;
-#endif
-    return (t <= T{0}) ? T{0} :
-            ((t >= T{1}) ? T{1} :
-             (t < T{0.5} ?
-            -T{0.5} * (math::pow(T{2}, T{20} * t - T{10}) * math::sin((sin_type)(T{20} * t - T{11.125}) * constants::elastic_factor2<T>())) :
-             T{0.5} * (math::pow(T{2}, -T{20} * t + T{10}) * math::sin((sin_type)(T{20} * t - T{11.125}) * constants::elastic_factor2<T>())) + T{1}));
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inOutElastic<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease out bounce
 /// @sa https://easings.net/#easeOutBounce
-template<typename T> constexpr T outBounce(const T t)
+template<typename T, class P = precision::default_policy> constexpr T outBounce(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return t < (T{1} / constants::bounce_factor<T>()) ? constants::bounce_factor2<T>() * t * t :
-            t < (T{2} / constants::bounce_factor<T>()) ? constants::bounce_factor2<T>() * (t - (T{1.5} / constants::bounce_factor<T>())) * (t - (T{1.5} / constants::bounce_factor<T>())) + T{0.75} :
-            t < (T{2.5} / constants::bounce_factor<T>()) ? constants::bounce_factor2<T>() * (t - (T{2.25} / constants::bounce_factor<T>())) * (t- (T{2.25} / constants::bounce_factor<T>())) + T{0.9375} :
-            constants::bounce_factor2<T>() * (t - (T{2.625} / constants::bounce_factor<T>())) * (t - (T{2.625} / constants::bounce_factor<T>())) + T{0.984375};
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::outBounce<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease in bounce
 /// @sa https://easings.net/#easeInBounce
-template<typename T> constexpr T inBounce(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inBounce(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return T{1} - outBounce<T>(T{1} - t);
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inBounce<C, P>(static_cast<C>(t)));
 }
 
 /// @brief Ease inout bounce
 /// @sa https://easings.net/#easeInOutBounce
-template<typename T>constexpr T inOutBounce(const T t)
+template<typename T, class P = precision::default_policy> constexpr T inOutBounce(const T t)
 {
-    static_assert(std::is_floating_point<T>::value, "t must be floating point number");
-    return t < T{0.5} ? (T{1} - outBounce<T>(T{1} - T{2} * t)) * T{0.5}
-            :  (T{1} + outBounce<T>(T{2} * t - T{1})) * T{0.5};
+    static_assert(is_floating_point<T>::value, "t must be floating point number");
+    using C = precision::compute_type<T, P>;
+    return static_cast<T>(detail::inOutBounce<C, P>(static_cast<C>(t)));
 }
 /// @}
+
+#if defined(__cpp_consteval)
+/*!
+  @namespace ce
+  @brief Consteval version of curves (C++20 or later)
+  @details Evaluation at runtime is a compile error, so tables are guaranteed to be baked at compile-time.
+*/
+namespace ce
+{
+///@name Consteval easing behavior
+///@sa Easing behavior
+///@{
+template<typename T, class P = precision::default_policy> consteval T linear(const T t) { return easing::linear<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inSinusoidal(const T t) { return easing::inSinusoidal<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T outSinusoidal(const T t) { return easing::outSinusoidal<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inOutSinusoidal(const T t) { return easing::inOutSinusoidal<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inQuadratic(const T t) { return easing::inQuadratic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T outQuadratic(const T t) { return easing::outQuadratic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inOutQuadratic(const T t) { return easing::inOutQuadratic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inCubic(const T t) { return easing::inCubic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T outCubic(const T t) { return easing::outCubic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inOutCubic(const T t) { return easing::inOutCubic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inQuartic(const T t) { return easing::inQuartic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T outQuartic(const T t) { return easing::outQuartic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inOutQuartic(const T t) { return easing::inOutQuartic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inQuintic(const T t) { return easing::inQuintic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T outQuintic(const T t) { return easing::outQuintic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inOutQuintic(const T t) { return easing::inOutQuintic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inExponential(const T t) { return easing::inExponential<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T outExponential(const T t) { return easing::outExponential<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inOutExponential(const T t) { return easing::inOutExponential<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inCircular(const T t) { return easing::inCircular<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T outCircular(const T t) { return easing::outCircular<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inOutCircular(const T t) { return easing::inOutCircular<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inBack(const T t) { return easing::inBack<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T outBack(const T t) { return easing::outBack<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inOutBack(const T t) { return easing::inOutBack<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inElastic(const T t) { return easing::inElastic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T outElastic(const T t) { return easing::outElastic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inOutElastic(const T t) { return easing::inOutElastic<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inBounce(const T t) { return easing::inBounce<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T outBounce(const T t) { return easing::outBounce<T, P>(t); }
+template<typename T, class P = precision::default_policy> consteval T inOutBounce(const T t) { return easing::inOutBounce<T, P>(t); }
+///@}
+
+///@cond 0
+template<typename F> struct result_of_function;
+template<typename R, typename A> struct result_of_function<R(*)(A)> { using type = R; };
+///@endcond
+
+/*!
+  @brief Make table of N elements (F(0 / (N-1)), F(1 / (N-1)) ... F((N-1) / (N-1)))
+  @tparam F Curve function (e.g. goblib::easing::inBounce<float>)
+  @tparam N Number of elements (2 or more)
+ */
+template<auto F, std::size_t N> consteval auto make_table()
+{
+    static_assert(N > 1, "N must be 2 or more");
+    using T = typename result_of_function<decltype(F)>::type;
+    std::array<T, N> table{};
+    for(std::size_t i = 0; i < N; ++i) { table[i] = F(static_cast<T>(i) / static_cast<T>(N - 1)); }
+    return table;
+}
+//
+}
+#endif
 }}
 #endif
@@ -0,0 +1,130 @@
+/*!
+  @file gob_easing_combinator.hpp
+  @brief Compile-time combination of the curves
+
+  Curves and combinators are empty function object types, so a combined curve is one type
+  whose call is inlined and constexpr (C++11 or later).
+  @code
+  namespace fn = goblib::easing::fn;
+  // inBack for 1/3 of the time, then outBounce
+  using drop = fn::chain<fn::inBack, fn::outBounce, std::ratio<1, 3>>;
+  constexpr float v = drop{}(0.5f);
+  float (*p)(const float) = fn::call<drop, float>; // Function pointer for tables
+  @endcode
+
+  @copyright 2024 GOB
+  @copyright Licensed under the MIT license. See LICENSE file in the project root for full license information.
+ */
+#ifndef GOB_EASING_COMBINATOR_HPP
+#define GOB_EASING_COMBINATOR_HPP
+
+#include "gob_easing_curve.hpp"
+#include <ratio>
+
+namespace goblib { namespace easing {
+/*!
+  @namespace fn
+  @brief Curves and combinators as function objects
+  @details Every type F has template<typename T> constexpr T operator()(const T t) const.
+  Combinators take curves or other combinators, and the parameters as std::ratio.
+ */
+namespace fn
+{
+/*!
+  @brief Curve as function object
+  @tparam C Curve
+  @tparam P Precision policy
+ */
+template<Curve C, class P = precision::default_policy> struct curve;
+
+///@cond 0
+#define GOBLIB_EASING_FN(name)                                                          \
+    template<class P> struct curve<Curve::name, P>                                      \
+    {                                                                                   \
+        template<typename T> constexpr T operator()(const T t) const { return easing::name<T, P>(t); } \
+    };                                                                                  \
+    using name = curve<Curve::name>
+
+GOBLIB_EASING_FN(linear);
+GOBLIB_EASING_FN(inSinusoidal); GOBLIB_EASING_FN(outSinusoidal); GOBLIB_EASING_FN(inOutSinusoidal);
+GOBLIB_EASING_FN(inQuadratic); GOBLIB_EASING_FN(outQuadratic); GOBLIB_EASING_FN(inOutQuadratic);
+GOBLIB_EASING_FN(inCubic); GOBLIB_EASING_FN(outCubic); GOBLIB_EASING_FN(inOutCubic);
+GOBLIB_EASING_FN(inQuartic); GOBLIB_EASING_FN(outQuartic); GOBLIB_EASING_FN(inOutQuartic);
+GOBLIB_EASING_FN(inQuintic); GOBLIB_EASING_FN(outQuintic); GOBLIB_EASING_FN(inOutQuintic);
+GOBLIB_EASING_FN(inExponential); GOBLIB_EASING_FN(outExponential); GOBLIB_EASING_FN(inOutExponential);
+GOBLIB_EASING_FN(inCircular); GOBLIB_EASING_FN(outCircular); GOBLIB_EASING_FN(inOutCircular);
+GOBLIB_EASING_FN(inBack); GOBLIB_EASING_FN(outBack); GOBLIB_EASING_FN(inOutBack);
+GOBLIB_EASING_FN(inElastic); GOBLIB_EASING_FN(outElastic); GOBLIB_EASING_FN(inOutElastic);
+GOBLIB_EASING_FN(inBounce); GOBLIB_EASING_FN(outBounce); GOBLIB_EASING_FN(inOutBounce);
+#undef GOBLIB_EASING_FN
+
+template<class R, typename T> constexpr T ratio_value() { return static_cast<T>(R::num) / static_cast<T>(R::den); }
+///@endcond
+
+/// @brief Reversed in time, f(1 - t) (from 1 to 0)
+template<class F> struct reverse
+{
+    template<typename T> constexpr T operator()(const T t) const { return F{}(T{1} - t); }
+};
+
+/// @brief Mirrored, 1 - f(1 - t) (in to out, out to in)
+template<class F> struct mirror
+{
+    template<typename T> constexpr T operator()(const T t) const { return T{1} - F{}(T{1} - t); }
+};
+
+/*!
+  @brief F until split, then G (each mapped to its part of time and value)
+  @details t < s ? s * f(t / s) : s + (1 - s) * g((t - s) / (1 - s))
+  @tparam Split std::ratio in (0, 1)
+ */
+template<class F, class G, class Split = std::ratio<1, 2>> struct chain
+{
+    static_assert(Split::num > 0 && Split::num < Split::den, "Split must be in (0, 1)");
+    template<typename T> constexpr T operator()(const T t) const
+    {
+        return t < ratio_value<Split, T>() ?
+                ratio_value<Split, T>() * F{}(t / ratio_value<Split, T>()) :
+                ratio_value<Split, T>() + (T{1} - ratio_value<Split, T>()) * G{}((t - ratio_value<Split, T>()) / (T{1} - ratio_value<Split, T>()));
+    }
+};
+
+/// @brief InOut curve from In and Out (e.g. inOutOf<inBack, outBounce>)
+template<class InF, class OutF> using inOutOf = chain<InF, OutF, std::ratio<1, 2>>;
+
+/*!
+  @brief Scaled in time, f(min(t * k, 1)) (k > 1 finishes early and holds)
+  @tparam K std::ratio greater than 0
+ */
+template<class F, class K> struct scale
+{
+    static_assert(K::num > 0, "K must be greater than 0");
+    template<typename T> constexpr T operator()(const T t) const
+    {
+        return F{}(t * ratio_value<K, T>() < T{1} ? t * ratio_value<K, T>() : T{1});
+    }
+};
+
+/*!
+  @brief Blended, (1 - w) * f(t) + w * g(t)
+  @tparam W std::ratio weight of G
+ */
+template<class F, class G, class W = std::ratio<1, 2>> struct blend
+{
+    template<typename T> constexpr T operator()(const T t) const
+    {
+        return (T{1} - ratio_value<W, T>()) * F{}(t) + ratio_value<W, T>() * G{}(t);
+    }
+};
+
+/*!
+  @brief Call F as a function (for function pointer tables and templates taking a function)
+  @code
+  constexpr auto table = goblib::easing::ce::make_table<fn::call<fn::mirror<fn::inBack>, float>, 32>(); // C++20
+  @endcode
+ */
+template<class F, typename T> constexpr T call(const T t) { return F{}(t); }
+//
+}
+}}
+#endif
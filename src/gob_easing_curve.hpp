@@ -0,0 +1,368 @@
+/*!
+  @file gob_easing_curve.hpp
+  @brief Runtime selection of the curves
+
+  Curves as enumerators, dispatched by a switch instead of function pointers.
+  For curve choices stored in data (configs, components, UI).
+
+  @copyright 2024 GOB
+  @copyright Licensed under the MIT license. See LICENSE file in the project root for full license information.
+ */
+#ifndef GOB_EASING_CURVE_HPP
+#define GOB_EASING_CURVE_HPP
+
+#include "gob_easing.hpp"
+#include <cstddef>
+#include <cstdint>
+
+// constexpr if C++14 or later (switch in constexpr function)
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+# define GOBLIB_EASING_CONSTEXPR14 constexpr
+#else
+# define GOBLIB_EASING_CONSTEXPR14 inline
+#endif
+
+namespace goblib { namespace easing {
+
+/*!
+  @enum Curve
+  @brief Curves
+  @details Same order as easings.net. The underlying values are stable and may be saved.
+ */
+enum class Curve : std::uint8_t
+{
+    linear,
+    inSinusoidal, outSinusoidal, inOutSinusoidal,
+    inQuadratic, outQuadratic, inOutQuadratic,
+    inCubic, outCubic, inOutCubic,
+    inQuartic, outQuartic, inOutQuartic,
+    inQuintic, outQuintic, inOutQuintic,
+    inExponential, outExponential, inOutExponential,
+    inCircular, outCircular, inOutCircular,
+    inBack, outBack, inOutBack,
+    inElastic, outElastic, inOutElastic,
+    inBounce, outBounce, inOutBounce,
+};
+constexpr std::size_t num_curves = static_cast<std::size_t>(Curve::inOutBounce) + 1; //!< Number of curves
+
+///@cond 0
+namespace detail
+{
+template<typename D = void> struct curve_name
+{
+    static constexpr const char* value[num_curves] =
+    {
+        "linear",
+        "inSinusoidal", "outSinusoidal", "inOutSinusoidal",
+        "inQuadratic", "outQuadratic", "inOutQuadratic",
+        "inCubic", "outCubic", "inOutCubic",
+        "inQuartic", "outQuartic", "inOutQuartic",
+        "inQuintic", "outQuintic", "inOutQuintic",
+        "inExponential", "outExponential", "inOutExponential",
+        "inCircular", "outCircular", "inOutCircular",
+        "inBack", "outBack", "inOutBack",
+        "inElastic", "outElastic", "inOutElastic",
+        "inBounce", "outBounce", "inOutBounce",
+    };
+};
+template<typename D> constexpr const char* curve_name<D>::value[num_curves];
+//
+}
+///@endcond
+
+/// @brief Name of the curve (nullptr if out of range)
+constexpr const char* name(const Curve c)
+{
+    return static_cast<std::size_t>(c) < num_curves ? detail::curve_name<>::value[static_cast<std::size_t>(c)] : nullptr;
+}
+
+/// @brief Function pointer of the curve
+template<typename T> using ease_function = T(*)(const T);
+
+///@cond 0
+namespace detail
+{
+template<typename T, class P> struct curve_function
+{
+    static constexpr ease_function<T> value[num_curves] =
+    {
+        easing::linear<T, P>,
+        easing::inSinusoidal<T, P>, easing::outSinusoidal<T, P>, easing::inOutSinusoidal<T, P>,
+        easing::inQuadratic<T, P>, easing::outQuadratic<T, P>, easing::inOutQuadratic<T, P>,
+        easing::inCubic<T, P>, easing::outCubic<T, P>, easing::inOutCubic<T, P>,
+        easing::inQuartic<T, P>, easing::outQuartic<T, P>, easing::inOutQuartic<T, P>,
+        easing::inQuintic<T, P>, easing::outQuintic<T, P>, easing::inOutQuintic<T, P>,
+        easing::inExponential<T, P>, easing::outExponential<T, P>, easing::inOutExponential<T, P>,
+        easing::inCircular<T, P>, easing::outCircular<T, P>, easing::inOutCircular<T, P>,
+        easing::inBack<T, P>, easing::outBack<T, P>, easing::inOutBack<T, P>,
+        easing::inElastic<T, P>, easing::outElastic<T, P>, easing::inOutElastic<T, P>,
+        easing::inBounce<T, P>, easing::outBounce<T, P>, easing::inOutBounce<T, P>,
+    };
+};
+template<typename T, class P> constexpr ease_function<T> curve_function<T, P>::value[num_curves];
+
+struct curve_key
+{
+    const char* name;
+    Curve curve;
+};
+
+// Perfect hash of the names: slot[hash] is the index of key (0xFF: empty)
+// Length and the 2nd and 4th characters from the end identify all keys, so only they are hashed (multiplicative).
+// The multiplier is searched for no collision among the keys. Regenerate slot if keys are changed.
+template<typename D = void> struct curve_registry
+{
+    static constexpr std::uint32_t multiplier = 0x1FFEAD87U;
+    static constexpr std::size_t min_length = 6;  // "linear", "inBack"
+    static constexpr std::size_t max_length = 20; // "easeInOutExponential"
+    static constexpr std::size_t num_keys = 80;
+    static constexpr curve_key key[num_keys] =
+    {
+        { "linear", Curve::linear }, { "easeLinear", Curve::linear },
+        { "inSinusoidal", Curve::inSinusoidal }, { "easeInSinusoidal", Curve::inSinusoidal },
+        { "outSinusoidal", Curve::outSinusoidal }, { "easeOutSinusoidal", Curve::outSinusoidal },
+        { "inOutSinusoidal", Curve::inOutSinusoidal }, { "easeInOutSinusoidal", Curve::inOutSinusoidal },
+        { "inQuadratic", Curve::inQuadratic }, { "easeInQuadratic", Curve::inQuadratic },
+        { "outQuadratic", Curve::outQuadratic }, { "easeOutQuadratic", Curve::outQuadratic },
+        { "inOutQuadratic", Curve::inOutQuadratic }, { "easeInOutQuadratic", Curve::inOutQuadratic },
+        { "inCubic", Curve::inCubic }, { "easeInCubic", Curve::inCubic },
+        { "outCubic", Curve::outCubic }, { "easeOutCubic", Curve::outCubic },
+        { "inOutCubic", Curve::inOutCubic }, { "easeInOutCubic", Curve::inOutCubic },
+        { "inQuartic", Curve::inQuartic }, { "easeInQuartic", Curve::inQuartic },
+        { "outQuartic", Curve::outQuartic }, { "easeOutQuartic", Curve::outQuartic },
+        { "inOutQuartic", Curve::inOutQuartic }, { "easeInOutQuartic", Curve::inOutQuartic },
+        { "inQuintic", Curve::inQuintic }, { "easeInQuintic", Curve::inQuintic },
+        { "outQuintic", Curve::outQuintic }, { "easeOutQuintic", Curve::outQuintic },
+        { "inOutQuintic", Curve::inOutQuintic }, { "easeInOutQuintic", Curve::inOutQuintic },
+        { "inExponential", Curve::inExponential }, { "easeInExponential", Curve::inExponential },
+        { "outExponential", Curve::outExponential }, { "easeOutExponential", Curve::outExponential },
+        { "inOutExponential", Curve::inOutExponential }, { "easeInOutExponential", Curve::inOutExponential },
+        { "inCircular", Curve::inCircular }, { "easeInCircular", Curve::inCircular },
+        { "outCircular", Curve::outCircular }, { "easeOutCircular", Curve::outCircular },
+        { "inOutCircular", Curve::inOutCircular }, { "easeInOutCircular", Curve::inOutCircular },
+        { "inBack", Curve::inBack }, { "easeInBack", Curve::inBack },
+        { "outBack", Curve::outBack }, { "easeOutBack", Curve::outBack },
+        { "inOutBack", Curve::inOutBack }, { "easeInOutBack", Curve::inOutBack },
+        { "inElastic", Curve::inElastic }, { "easeInElastic", Curve::inElastic },
+        { "outElastic", Curve::outElastic }, { "easeOutElastic", Curve::outElastic },
+        { "inOutElastic", Curve::inOutElastic }, { "easeInOutElastic", Curve::inOutElastic },
+        { "inBounce", Curve::inBounce }, { "easeInBounce", Curve::inBounce },
+        { "outBounce", Curve::outBounce }, { "easeOutBounce", Curve::outBounce },
+        { "inOutBounce", Curve::inOutBounce }, { "easeInOutBounce", Curve::inOutBounce },
+        // easings.net
+        { "easeInSine", Curve::inSinusoidal }, { "easeOutSine", Curve::outSinusoidal }, { "easeInOutSine", Curve::inOutSinusoidal },
+        { "easeInQuad", Curve::inQuadratic }, { "easeOutQuad", Curve::outQuadratic }, { "easeInOutQuad", Curve::inOutQuadratic },
+        { "easeInQuart", Curve::inQuartic }, { "easeOutQuart", Curve::outQuartic }, { "easeInOutQuart", Curve::inOutQuartic },
+        { "easeInQuint", Curve::inQuintic }, { "easeOutQuint", Curve::outQuintic }, { "easeInOutQuint", Curve::inOutQuintic },
+        { "easeInExpo", Curve::inExponential }, { "easeOutExpo", Curve::outExponential }, { "easeInOutExpo", Curve::inOutExponential },
+        { "easeInCirc", Curve::inCircular }, { "easeOutCirc", Curve::outCircular }, { "easeInOutCirc", Curve::inOutCircular },
+    };
+    static constexpr std::uint8_t slot[128] =
+    {
+        255,  18,  31,  67,  51, 255,   7,  38,  63,  77,   9,  68,  46, 255,  71, 255,
+         36,  15,  26, 255,  53,  60,   2,  40, 255,  78,  11,  69, 255,  24,  72, 255,
+         33,  17,  28, 255, 255,  57,   4,   1,  64, 255, 255, 255,  48,  21, 255, 255,
+         35, 255, 255, 255,  55,  59, 255,  42,  74,  79,  13,  70,  45,  23,  73, 255,
+        255,  19,  30, 255,  50, 255,   6,  39,  75, 255,   8, 255,  47, 255, 255, 255,
+         37,  14,  27,  65,  52,  61,   3,  41, 255, 255,  10, 255, 255,  25, 255, 255,
+         32,  16,  29,  66, 255,  56,   5,   0,  76, 255, 255, 255,  49,  20, 255, 255,
+         34, 255, 255, 255,  54,  58, 255,  43,  62, 255,  12, 255,  44,  22, 255, 255,
+    };
+};
+template<typename D> constexpr curve_key curve_registry<D>::key[curve_registry<D>::num_keys];
+template<typename D> constexpr std::uint8_t curve_registry<D>::slot[128];
+
+// len must be [min_length, max_length]
+constexpr std::uint32_t name_hash(const char* s, const std::size_t len)
+{
+    return static_cast<std::uint32_t>((static_cast<std::uint32_t>(len)
+                                       | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(s[len - 2])) << 8)
+                                       | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(s[len - 4])) << 16))
+                                      * curve_registry<>::multiplier) >> 25;
+}
+// Length of s, up to limit
+// First len characters of s are key
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+constexpr std::size_t name_length(const char* s, const std::size_t limit)
+{
+    std::size_t n = 0;
+    while(n < limit && s[n]) { ++n; }
+    return n;
+}
+constexpr bool name_equal(const char* key, const char* s, const std::size_t len)
+{
+    for(std::size_t i = 0; i < len; ++i) { if(key[i] != s[i]) { return false; } }
+    return key[len] == '\0';
+}
+#else
+constexpr std::size_t name_length(const char* s, const std::size_t limit)
+{
+    return (limit && *s) ? 1 + name_length(s + 1, limit - 1) : 0;
+}
+constexpr bool name_equal(const char* key, const char* s, const std::size_t len)
+{
+    return len ? (*key == *s && name_equal(key + 1, s + 1, len - 1)) : *key == '\0';
+}
+#endif
+//
+}
+///@endcond
+
+/// @brief Result of find_curve
+struct curve_lookup
+{
+    Curve curve;  //!< Found curve (linear if not found)
+    bool found;   //!< Found?
+    constexpr explicit operator bool() const noexcept { return found; }
+};
+
+///@cond 0
+namespace detail
+{
+constexpr curve_lookup find_curve_index(const char* s, const std::size_t len, const std::uint8_t idx)
+{
+    return (idx != 0xFF && name_equal(curve_registry<>::key[idx].name, s, len)) ?
+            curve_lookup{curve_registry<>::key[idx].curve, true} : curve_lookup{Curve::linear, false};
+}
+//
+}
+///@endcond
+
+/*!
+  @brief Find the curve by name
+  @details Names of this library (inOutBack), with "ease" (easeInOutBack) and of easings.net (easeInOutSine, easeInOutQuad ...).
+  A perfect hash of the length and two characters, then one comparison. No allocation.
+  @param s Name (not necessarily null-terminated)
+  @param len Length of the name
+  @code
+  auto r = goblib::easing::find_curve("easeOutElastic");
+  if(r) { float v = goblib::easing::evaluate(r.curve, t); }
+  @endcode
+ */
+constexpr curve_lookup find_curve(const char* s, const std::size_t len)
+{
+    return (s && len >= detail::curve_registry<>::min_length && len <= detail::curve_registry<>::max_length) ?
+            detail::find_curve_index(s, len, detail::curve_registry<>::slot[detail::name_hash(s, len)]) :
+            curve_lookup{Curve::linear, false};
+}
+/// @brief Find the curve by null-terminated name
+constexpr curve_lookup find_curve(const char* s)
+{
+    return s ? find_curve(s, detail::name_length(s, detail::curve_registry<>::max_length + 1)) : curve_lookup{Curve::linear, false};
+}
+
+/// @brief Function pointer of the curve (nullptr if out of range)
+template<typename T, class P = precision::default_policy> constexpr ease_function<T> function(const Curve c)
+{
+    return static_cast<std::size_t>(c) < num_curves ? detail::curve_function<T, P>::value[static_cast<std::size_t>(c)] : nullptr;
+}
+
+/*!
+  @brief Evaluate the curve
+  @details A switch with the curve templates inlined in each case, compiled to a jump table
+  (no indirect call through a function pointer). Out of range value is linear.
+  @tparam T Floating point number type
+  @tparam P Precision policy
+  @note constexpr in C++14 or later
+ */
+template<typename T, class P = precision::default_policy> GOBLIB_EASING_CONSTEXPR14 T evaluate(const Curve c, const T t)
+{
+    switch(c)
+    {
+    case Curve::linear:           return linear<T, P>(t);
+    case Curve::inSinusoidal:     return inSinusoidal<T, P>(t);
+    case Curve::outSinusoidal:    return outSinusoidal<T, P>(t);
+    case Curve::inOutSinusoidal:  return inOutSinusoidal<T, P>(t);
+    case Curve::inQuadratic:      return inQuadratic<T, P>(t);
+    case Curve::outQuadratic:     return outQuadratic<T, P>(t);
+    case Curve::inOutQuadratic:   return inOutQuadratic<T, P>(t);
+    case Curve::inCubic:          return inCubic<T, P>(t);
+    case Curve::outCubic:         return outCubic<T, P>(t);
+    case Curve::inOutCubic:       return inOutCubic<T, P>(t);
+    case Curve::inQuartic:        return inQuartic<T, P>(t);
+    case Curve::outQuartic:       return outQuartic<T, P>(t);
+    case Curve::inOutQuartic:     return inOutQuartic<T, P>(t);
+    case Curve::inQuintic:        return inQuintic<T, P>(t);
+    case Curve::outQuintic:       return outQuintic<T, P>(t);
+    case Curve::inOutQuintic:     return inOutQuintic<T, P>(t);
+    case Curve::inExponential:    return inExponential<T, P>(t);
+    case Curve::outExponential:   return outExponential<T, P>(t);
+    case Curve::inOutExponential: return inOutExponential<T, P>(t);
+    case Curve::inCircular:       return inCircular<T, P>(t);
+    case Curve::outCircular:      return outCircular<T, P>(t);
+    case Curve::inOutCircular:    return inOutCircular<T, P>(t);
+    case Curve::inBack:           return inBack<T, P>(t);
+    case Curve::outBack:          return outBack<T, P>(t);
+    case Curve::inOutBack:        return inOutBack<T, P>(t);
+    case Curve::inElastic:        return inElastic<T, P>(t);
+    case Curve::outElastic:       return outElastic<T, P>(t);
+    case Curve::inOutElastic:     return inOutElastic<T, P>(t);
+    case Curve::inBounce:         return inBounce<T, P>(t);
+    case Curve::outBounce:        return outBounce<T, P>(t);
+    case Curve::inOutBounce:      return inOutBounce<T, P>(t);
+    }
+    return linear<T, P>(t);
+}
+
+///@cond 0
+namespace detail
+{
+// Back with the overshoot s (c1), same expressions as the fixed constants
+template<typename T> GOBLIB_EASING_CONSTEXPR14 T inBack_overshoot(const T t, const T s)
+{
+    return t * t * ((s + T{1}) * t - s);
+}
+template<typename T> GOBLIB_EASING_CONSTEXPR14 T outBack_overshoot(const T t, const T s)
+{
+    const T u = t - T{1};
+    return u * u * ((s + T{1}) * u + s) + T{1};
+}
+template<typename T> GOBLIB_EASING_CONSTEXPR14 T inOutBack_overshoot(const T t, const T s)
+{
+    const T c2 = s * T{1.525};
+    const T t2 = t * T{2};
+    if(t2 < T{1}) { return T{0.5} * (t2 * t2 * ((c2 + T{1}) * t2 - c2)); }
+    const T u = t2 - T{2};
+    return T{0.5} * (u * u * ((c2 + T{1}) * u + c2) + T{2});
+}
+//
+}
+///@endcond
+
+/*!
+  @brief Curve with parameters as a value
+  @details Trivially copyable and no allocation, can be stored in arrays and copied by memcpy.
+  Evaluated by evaluate (switch) except for Back, which uses the overshoot.
+  With the default overshoot, the result is the same as the curve function.
+  @tparam T Floating point number type
+  @tparam P Precision policy
+  @note 16 bytes or less if T is float or double
+ */
+template<typename T, class P = precision::default_policy> struct Ease
+{
+    static_assert(is_floating_point<T>::value, "T must be floating point number");
+
+    Curve curve{Curve::linear};                              //!< Curve
+    T overshoot{constants::derived<T>::back_c1};             //!< Overshoot of Back (c1 = 1.70158 by default)
+
+    constexpr Ease() noexcept = default;
+    /// @brief Curve and overshoot of Back
+    constexpr explicit Ease(const Curve c, const T s = constants::derived<T>::back_c1) noexcept : curve{c}, overshoot{s} {}
+
+    /// @brief Evaluate the curve
+    /// @note constexpr in C++14 or later
+    GOBLIB_EASING_CONSTEXPR14 T operator()(const T t) const
+    {
+        using C = precision::compute_type<T, P>;
+        switch(curve)
+        {
+        case Curve::inBack:    return static_cast<T>(detail::inBack_overshoot<C>(static_cast<C>(t), static_cast<C>(overshoot)));
+        case Curve::outBack:   return static_cast<T>(detail::outBack_overshoot<C>(static_cast<C>(t), static_cast<C>(overshoot)));
+        case Curve::inOutBack: return static_cast<T>(detail::inOutBack_overshoot<C>(static_cast<C>(t), static_cast<C>(overshoot)));
+        default: break;
+        }
+        return evaluate<T, P>(curve, t);
+    }
+};
+}}
+#endif
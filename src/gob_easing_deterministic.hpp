@@ -0,0 +1,278 @@
+/*!
+  @file gob_easing_deterministic.hpp
+  @brief Bit-exact deterministic easing functions
+
+  Same results on every compiler, platform and build option (libm, FMA contraction, -ffast-math).
+  For lockstep multiplayer and replays.
+
+  @copyright 2024 GOB
+  @copyright Licensed under the MIT license. See LICENSE file in the project root for full license information.
+ */
+#ifndef GOB_EASING_DETERMINISTIC_HPP
+#define GOB_EASING_DETERMINISTIC_HPP
+
+#include "gob_easing_fixed.hpp"
+
+namespace goblib { namespace easing {
+
+/*!
+  @namespace deterministic
+  @brief Bit-exact deterministic easing functions
+  @details Curves are evaluated by the Q30 integer kernels of fx, no libm call and no floating point arithmetic.
+  Floating point is used only for conversions, which are exact or a single rounding:
+  - t * 2^30, its integer part and fraction are exact, so the conversion to Q30 is exact for any evaluation method.
+  - Q30 to T is one int64 to T conversion (correctly rounded) and a multiplication by 2^-30 (exact).
+  - Circular converts the distance to its endpoint (1 - t, 2t - 1 etc., exact in T) scaled by a power of 4 (exact),
+    since its slope is infinite there. The root is scaled back in integer.
+  .
+  Argument is clamped to [0, 1] (NaN is 0). Exponential and Elastic keep their steps at the ends:
+  positive arguments below 2^-31 are 2^-30 (in, inOut), arguments in [1 - 2^-31, 1) are 1 - 2^-30 (out, inOut).
+  @warning Requires IEEE 754 float and double without extended precision (SSE2 on x86).
+  @note All functions are constexpr (C++11).
+  @note The error of double results against the double template is below 7e-9, mostly the rounding of the argument to Q30 times the slope
+  (largest for Exponential and Elastic, 10 ln 2). Float results add the rounding to float (below 6.2e-8).
+  Test deterministic.precision prints it on and off the grid, bench_exhaustive for all float arguments.
+  @code
+  namespace easing = goblib::easing::deterministic; // Switch the curves
+  float v = easing::inOutElastic(t);
+  @endcode
+*/
+namespace deterministic
+{
+///@cond 0
+namespace detail
+{
+using q30_t = fx::detail::q30_t;
+constexpr q30_t one30 = fx::detail::one30;
+
+// round(s) (s = t * 2^30 in [0, 2^30], exact)
+template<typename T> constexpr q30_t round30_i(const T s, const q30_t i) { return i + (s - static_cast<T>(i) >= T{0.5}); }
+template<typename T> constexpr q30_t to30(const T t)
+{
+    return !(t > T{0}) ? 0 : t >= T{1} ? one30 : round30_i(t * static_cast<T>(one30), static_cast<q30_t>(t * static_cast<T>(one30)));
+}
+// Keep the steps of Exponential and Elastic (2^-10 for inExponential at 0 and outExponential at 1):
+// positive t is at least 1, t below 1 is at most one30 - 1
+template<typename T> constexpr q30_t to30_step0(const T t) { return (t > T{0} && to30(t) == 0) ? 1 : to30(t); }
+template<typename T> constexpr q30_t to30_step1(const T t) { return (t < T{1} && to30(t) == one30) ? one30 - 1 : to30(t); }
+template<typename T> constexpr q30_t to30_steps(const T t) { return t < T{0.5} ? to30_step0(t) : to30_step1(t); }
+template<typename T> constexpr T from30(const q30_t v) { return static_cast<T>(v) * (T{1} / static_cast<T>(one30)); }
+
+// sqrt(s * (2 - s)) in Q30 for s in (0, 1] (s is exact in T, the distance to the endpoint of Circular)
+// The slope is infinite at s = 0, so s is scaled by 4^k into [1/4, 1) before Q30 and the root by 2^-k after it.
+// k = 0 is the same integer as fx (one30^2 - (one30 - s)^2)
+template<typename T> constexpr q30_t circle_k(const T u, const q30_t s, const int k)
+{
+    return k >= 32 ? 0 :
+            u < T{0.25} ? circle_k(u * T{4}, s, k + 1) :
+            fx::detail::shift_round(fx::detail::sqrt60(static_cast<std::uint64_t>(to30(u) * (2 * one30 - s))), k);
+}
+template<typename T> constexpr q30_t circle(const T s) { return circle_k(s, to30(s), 0); }
+
+template<typename T> constexpr q30_t inCircular(const T t)
+{
+    return !(t >= T{0.5}) ? fx::detail::inCircular(to30(t)) : t >= T{1} ? one30 : one30 - circle(T{1} - t);
+}
+template<typename T> constexpr q30_t outCircular(const T t) { return !(t > T{0}) ? 0 : t >= T{1} ? one30 : circle(t); }
+template<typename T> constexpr q30_t inOutCircular(const T t)
+{
+    return !(t >= T{0.25} && t <= T{0.75}) ? fx::detail::inOutCircular(to30(t)) :
+            t < T{0.5} ? fx::detail::half(one30 - circle(T{1} - t * T{2})) :
+            t > T{0.5} ? fx::detail::half(circle(t * T{2} - T{1}) + one30) : one30 / 2;
+}
+//
+}
+///@endcond
+
+///@name Easing behavior (deterministic)
+///@{
+/// @brief Linear
+template<typename T = float> constexpr T linear(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::linear(detail::to30(t)));
+}
+/// @brief Ease in sinusoidal
+template<typename T = float> constexpr T inSinusoidal(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inSinusoidal(detail::to30(t)));
+}
+/// @brief Ease out sinusoidal
+template<typename T = float> constexpr T outSinusoidal(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::outSinusoidal(detail::to30(t)));
+}
+/// @brief Ease inout sinusoidal
+template<typename T = float> constexpr T inOutSinusoidal(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inOutSinusoidal(detail::to30(t)));
+}
+/// @brief Ease in quadratic
+template<typename T = float> constexpr T inQuadratic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inQuadratic(detail::to30(t)));
+}
+/// @brief Ease out quadratic
+template<typename T = float> constexpr T outQuadratic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::outQuadratic(detail::to30(t)));
+}
+/// @brief Ease inout quadratic
+template<typename T = float> constexpr T inOutQuadratic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inOutQuadratic(detail::to30(t)));
+}
+/// @brief Ease in cubic
+template<typename T = float> constexpr T inCubic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inCubic(detail::to30(t)));
+}
+/// @brief Ease out cubic
+template<typename T = float> constexpr T outCubic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::outCubic(detail::to30(t)));
+}
+/// @brief Ease inout cubic
+template<typename T = float> constexpr T inOutCubic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inOutCubic(detail::to30(t)));
+}
+/// @brief Ease in quartic
+template<typename T = float> constexpr T inQuartic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inQuartic(detail::to30(t)));
+}
+/// @brief Ease out quartic
+template<typename T = float> constexpr T outQuartic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::outQuartic(detail::to30(t)));
+}
+/// @brief Ease inout quartic
+template<typename T = float> constexpr T inOutQuartic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inOutQuartic(detail::to30(t)));
+}
+/// @brief Ease in quintic
+template<typename T = float> constexpr T inQuintic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inQuintic(detail::to30(t)));
+}
+/// @brief Ease out quintic
+template<typename T = float> constexpr T outQuintic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::outQuintic(detail::to30(t)));
+}
+/// @brief Ease inout quintic
+template<typename T = float> constexpr T inOutQuintic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inOutQuintic(detail::to30(t)));
+}
+/// @brief Ease in exponential
+template<typename T = float> constexpr T inExponential(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inExponential(detail::to30_step0(t)));
+}
+/// @brief Ease out exponential
+template<typename T = float> constexpr T outExponential(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::outExponential(detail::to30_step1(t)));
+}
+/// @brief Ease inout exponential
+template<typename T = float> constexpr T inOutExponential(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inOutExponential(detail::to30_steps(t)));
+}
+/// @brief Ease in circular
+template<typename T = float> constexpr T inCircular(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(detail::inCircular(t));
+}
+/// @brief Ease out circular
+template<typename T = float> constexpr T outCircular(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(detail::outCircular(t));
+}
+/// @brief Ease inout circular
+template<typename T = float> constexpr T inOutCircular(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(detail::inOutCircular(t));
+}
+/// @brief Ease in back
+template<typename T = float> constexpr T inBack(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inBack(detail::to30(t)));
+}
+/// @brief Ease out back
+template<typename T = float> constexpr T outBack(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::outBack(detail::to30(t)));
+}
+/// @brief Ease inout back
+template<typename T = float> constexpr T inOutBack(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inOutBack(detail::to30(t)));
+}
+/// @brief Ease in elastic
+template<typename T = float> constexpr T inElastic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inElastic(detail::to30_step0(t)));
+}
+/// @brief Ease out elastic
+template<typename T = float> constexpr T outElastic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::outElastic(detail::to30_step1(t)));
+}
+/// @brief Ease inout elastic
+template<typename T = float> constexpr T inOutElastic(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inOutElastic(detail::to30_steps(t)));
+}
+/// @brief Ease in bounce
+template<typename T = float> constexpr T inBounce(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inBounce(detail::to30(t)));
+}
+/// @brief Ease out bounce
+template<typename T = float> constexpr T outBounce(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::outBounce(detail::to30(t)));
+}
+/// @brief Ease inout bounce
+template<typename T = float> constexpr T inOutBounce(const T t)
+{
+    static_assert(std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559, "T must be IEEE 754 floating point number");
+    return detail::from30<T>(fx::detail::inOutBounce(detail::to30(t)));
+}
+///@}
+}//
+}}
+#endif
@@ -0,0 +1,247 @@
+/*!
+  @file gob_easing_double_double.hpp
+  @brief Double-double floating point number for gob_easing
+
+  Pair of double (hi + lo) with about 106 bits of significand.
+  For reference values and offline baking without long double portability issues.
+  Needs C++14 or later (constexpr arithmetic).
+
+  @copyright 2024 GOB
+  @copyright Licensed under the MIT license. See LICENSE file in the project root for full license information.
+ */
+#ifndef GOB_EASING_DOUBLE_DOUBLE_HPP
+#define GOB_EASING_DOUBLE_DOUBLE_HPP
+
+#include "gob_easing.hpp"
+
+#if !defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+# error "gob_easing_double_double.hpp needs C++14 or later"
+#endif
+
+namespace goblib { namespace easing {
+
+/*!
+  @brief Double-double floating point number
+  @details Value is hi + lo (|lo| <= ulp(hi) / 2).
+  All arithmetic is constexpr. Works with all curves with the exact policy.
+  @warning Requires IEEE double without extended precision (SSE2 on x86).
+  @warning Under -ffast-math, the error terms are kept only if the compiler has __builtin_assoc_barrier (GCC 12 or later).
+ */
+struct double_double
+{
+    double hi{}; //!< Higher part
+    double lo{}; //!< Lower part
+
+    constexpr double_double() = default;
+    constexpr double_double(const double h) : hi{h}, lo{0.0} {}
+    constexpr double_double(const double h, const double l) : hi{h}, lo{l} {}
+
+    ///@name Round to built-in floating point type
+    ///@{
+    explicit constexpr operator float() const { return static_cast<float>(hi); }
+    explicit constexpr operator double() const { return hi; }
+    explicit constexpr operator long double() const { return static_cast<long double>(hi) + static_cast<long double>(lo); }
+    ///@}
+
+    constexpr double_double operator-() const { return double_double{-hi, -lo}; }
+    constexpr double_double& operator+=(const double_double& o);
+    constexpr double_double& operator-=(const double_double& o);
+    constexpr double_double& operator*=(const double_double& o);
+    constexpr double_double& operator/=(const double_double& o);
+};
+
+template<> struct is_floating_point<double_double> : std::true_type {};
+
+///@cond 0
+namespace dd
+{
+// Error free transformations
+// Results are kept opaque by GOBLIB_EASING_ASSOC_BARRIER, so -ffast-math cannot cancel the error terms.
+constexpr double_double quick_two_sum(const double a, const double b)
+{
+    const double s = GOBLIB_EASING_ASSOC_BARRIER(a + b);
+    return double_double{s, b - GOBLIB_EASING_ASSOC_BARRIER(s - a)};
+}
+constexpr double_double two_sum(const double a, const double b)
+{
+    const double s = GOBLIB_EASING_ASSOC_BARRIER(a + b);
+    const double bb = GOBLIB_EASING_ASSOC_BARRIER(s - a);
+    return double_double{s, GOBLIB_EASING_ASSOC_BARRIER(a - GOBLIB_EASING_ASSOC_BARRIER(s - bb)) + GOBLIB_EASING_ASSOC_BARRIER(b - bb)};
+}
+// Dekker split (No FMA in constexpr)
+constexpr double_double split(const double a)
+{
+    const double t = GOBLIB_EASING_ASSOC_BARRIER(134217729.0 * a); // 2^27 + 1
+    const double hi = GOBLIB_EASING_ASSOC_BARRIER(t - GOBLIB_EASING_ASSOC_BARRIER(t - a));
+    return double_double{hi, a - hi};
+}
+constexpr double_double two_prod(const double a, const double b)
+{
+    const double p = GOBLIB_EASING_ASSOC_BARRIER(a * b);
+    const double_double as = split(a);
+    const double_double bs = split(b);
+    return double_double{p, GOBLIB_EASING_ASSOC_BARRIER(GOBLIB_EASING_ASSOC_BARRIER(as.hi * bs.hi - p) + as.hi * bs.lo + as.lo * bs.hi) + as.lo * bs.lo};
+}
+constexpr double_double ln2{6.931471805599452862e-01, 2.319046813846299558e-17};
+//
+}
+///@endcond
+
+/// @name Arithmetic
+/// @{
+constexpr double_double operator+(const double_double& a, const double_double& b)
+{
+    const double_double s = dd::two_sum(a.hi, b.hi);
+    const double_double t = dd::two_sum(a.lo, b.lo);
+    const double_double u = dd::quick_two_sum(s.hi, s.lo + t.hi);
+    return dd::quick_two_sum(u.hi, u.lo + t.lo);
+}
+constexpr double_double operator-(const double_double& a, const double_double& b) { return a + (-b); }
+constexpr double_double operator*(const double_double& a, const double_double& b)
+{
+    const double_double p = dd::two_prod(a.hi, b.hi);
+    return dd::quick_two_sum(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+}
+constexpr double_double operator/(const double_double& a, const double_double& b)
+{
+    const double q1 = a.hi / b.hi;
+    const double_double r1 = a - b * q1;
+    const double q2 = r1.hi / b.hi;
+    const double_double r2 = r1 - b * q2;
+    const double q3 = r2.hi / b.hi;
+    return dd::quick_two_sum(q1, q2) + q3;
+}
+constexpr double_double& double_double::operator+=(const double_double& o) { return *this = *this + o; }
+constexpr double_double& double_double::operator-=(const double_double& o) { return *this = *this - o; }
+constexpr double_double& double_double::operator*=(const double_double& o) { return *this = *this * o; }
+constexpr double_double& double_double::operator/=(const double_double& o) { return *this = *this / o; }
+
+constexpr bool operator==(const double_double& a, const double_double& b) { return a.hi == b.hi && a.lo == b.lo; }
+constexpr bool operator!=(const double_double& a, const double_double& b) { return !(a == b); }
+constexpr bool operator< (const double_double& a, const double_double& b) { return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo); }
+constexpr bool operator> (const double_double& a, const double_double& b) { return b < a; }
+constexpr bool operator<=(const double_double& a, const double_double& b) { return !(b < a); }
+constexpr bool operator>=(const double_double& a, const double_double& b) { return !(a < b); }
+/// @}
+
+namespace constants
+{
+///@cond 0
+template<> constexpr double_double pi<double_double>() noexcept
+{
+    return double_double{3.141592653589793116e+00, 1.224646799147353207e-16};
+}
+template<> constexpr double_double e<double_double>() noexcept
+{
+    return double_double{2.718281828459045091e+00, 1.445646891729250158e-16};
+}
+// Back factors are decimal, so not exact in double
+template<> constexpr double_double back_factor<double_double>() noexcept
+{
+    return double_double{1.70158, -9.244160992238904e-17}; // 1.70158
+}
+template<> constexpr double_double back_factor2<double_double>() noexcept
+{
+    return double_double{2.5949095, 2.000888343900442e-17}; // 1.70158 * 1.525
+}
+///@endcond
+}//
+
+namespace math
+{
+/// @name Double-double arithmetic functions
+/// @{
+/// @brief Square root (One Newton step from double)
+constexpr double_double sqrt(const double_double x)
+{
+    if(x.hi <= 0.0) { return double_double{x.hi < 0.0 ? std::numeric_limits<double>::quiet_NaN() : 0.0}; }
+    const double_double q{math::sqrt(x.hi)};
+    return q + (x - q * q) / (q * 2.0);
+}
+
+/// @brief 2^x
+constexpr double_double exp2(const double_double x)
+{
+    const std::int32_t n = round_int(x.hi);
+    const double_double r = (x - static_cast<double>(n)) * dd::ln2; // |r| <= ln2/2
+    double_double sum{1.0};
+    double_double term{1.0};
+    for(int i = 1; i < 32; ++i)
+    {
+        term = term * r / static_cast<double>(i);
+        sum += term;
+        if(abs(term.hi) < 1e-34) { break; }
+    }
+    const double scale = pow2i<double>(n);
+    return double_double{sum.hi * scale, sum.lo * scale};
+}
+
+///@cond 0
+// sin(r + q * pi/2), |r| <= pi/4
+constexpr double_double sin_quadrant(const double_double r, const std::int32_t q)
+{
+    const double_double r2 = r * r;
+    const bool odd = q & 1;
+    double_double term = odd ? double_double{1.0} : r;
+    double_double sum = term;
+    for(int i = odd ? 1 : 2; i < 64; i += 2)
+    {
+        term = -term * r2 / static_cast<double>(i * (i + 1));
+        sum += term;
+        if(abs(term.hi) < 1e-34) { break; }
+    }
+    return (q & 2) ? -sum : sum;
+}
+constexpr double_double sin_shift(const double_double x, const std::int32_t shift)
+{
+    const double_double half_pi = constants::pi<double_double>() * 0.5;
+    const std::int32_t k = round_int(x.hi / half_pi.hi);
+    return sin_quadrant(x - half_pi * static_cast<double>(k), (k + shift) & 3);
+}
+///@endcond
+
+/// @brief sin
+constexpr double_double sin(const double_double x) { return sin_shift(x, 0); }
+/// @brief cos
+constexpr double_double cos(const double_double x) { return sin_shift(x, 1); }
+/// @}
+}//
+
+///@cond 0
+namespace precision
+{
+template<> constexpr double_double exact::sin<double_double>(const double_double x) { return math::sin(x); }
+template<> constexpr double_double exact::cos<double_double>(const double_double x) { return math::cos(x); }
+template<> constexpr double_double exact::exp2<double_double>(const double_double x) { return math::exp2(x); }
+template<> constexpr double_double exact::sqrt<double_double>(const double_double x) { return math::sqrt(x); }
+}//
+///@endcond
+}}
+
+///@cond 0
+namespace std
+{
+template<> class numeric_limits<goblib::easing::double_double>
+{
+  public:
+    using type = goblib::easing::double_double;
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 106;
+    static constexpr int digits10 = 31;
+    static constexpr int radix = 2;
+    static constexpr type min() noexcept { return type{numeric_limits<double>::min() * 9007199254740992.0}; } // 2^53
+    static constexpr type max() noexcept { return type{numeric_limits<double>::max(), numeric_limits<double>::max() * 1.1102230246251565e-16}; }
+    static constexpr type lowest() noexcept { return -max(); }
+    static constexpr type epsilon() noexcept { return type{4.93038065763132e-32}; } // 2^-104
+    static constexpr type infinity() noexcept { return type{numeric_limits<double>::infinity()}; }
+    static constexpr type quiet_NaN() noexcept { return type{numeric_limits<double>::quiet_NaN()}; }
+};
+//
+}
+///@endcond
+#endif
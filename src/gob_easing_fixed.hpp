@@ -0,0 +1,902 @@
+/*!
+  @file gob_easing_fixed.hpp
+  @brief Fixed-point easing functions (Q16.16, Q1.15) and arithmetic functions
+
+  All curves of gob_easing in integer arithmetic only.
+  For FPU-less targets and deterministic simulation.
+
+  @copyright 2024 GOB
+  @copyright Licensed under the MIT license. See LICENSE file in the project root for full license information.
+ */
+#ifndef GOB_EASING_FIXED_HPP
+#define GOB_EASING_FIXED_HPP
+
+#include "gob_easing.hpp"
+#include <climits>
+#include <ratio>
+
+// Count leading zeros by the instruction if available (constexpr in GCC and Clang)
+#if defined(__has_builtin)
+# if __has_builtin(__builtin_clz) && (UINT_MAX == 0xFFFFFFFFU)
+#  define GOBLIB_EASING_BUILTIN_CLZ
+# endif
+#endif
+
+namespace goblib { namespace easing {
+
+/*!
+  @namespace fx
+  @brief Fixed-point easing functions
+  @details Argument and result are Q16.16 in std::int32_t (1.0 is 65536).
+  Curves are evaluated in Q30 (std::int64_t) and rounded to Q16.16 once,
+  using integer polynomials, a polynomial sin in turns, a polynomial exp2 and an integer square root.
+  No floating point operation is executed at runtime.
+  @note All functions are constexpr (C++11).
+  @note Signed right shift is assumed to be arithmetic (true for GCC, Clang and MSVC).
+
+  Maximum error in Q16.16 LSB (1 / 65536) for all 65537 arguments in [0, 1].
+  "vs double" is against the double template, "vs float" is against the float template.
+  |Curve|vs double|vs float|
+  |---|---:|---:|
+  |linear|0.00|0.00|
+  |Sinusoidal|0.50|0.51|
+  |Quadratic, Cubic, Quartic, Quintic|0.50|0.50|
+  |Exponential|0.50|0.50|
+  |Circular|0.50|0.51|
+  |Back|0.50|0.50|
+  |Elastic|0.50|0.51|
+  |Bounce|0.50|0.50|
+  The error of the Q30 evaluation is below 1e-7, so results are the double curve rounded to Q16.16.
+  Back and Bounce skip Q30 and round the exact rational value once (bit-exact on every platform).
+  Bounce uses 121/16 = (11/4)^2 and its dyadic offsets as is, Back uses c1 and c2 as k / 2^24 (error below 1.2e-8).
+  "vs float" includes the error of the float template (own math functions).
+  @sa test/test_fixed.cpp (fixed.precision prints the table)
+*/
+namespace fx
+{
+using q16_t = std::int32_t; //!< Q16.16
+constexpr int fraction_bits = 16; //!< Number of fractional bits
+constexpr q16_t one = q16_t{1} << fraction_bits; //!< 1.0
+constexpr q16_t half = one >> 1; //!< 0.5
+
+/// @brief Floating point to Q16.16 (round to nearest)
+template<typename F> constexpr q16_t from_float(const F x)
+{
+    static_assert(std::is_floating_point<F>::value, "x must be floating point number");
+    return static_cast<q16_t>(x * F{65536} + (x < F{0} ? F{-0.5} : F{0.5}));
+}
+/// @brief Q16.16 to floating point
+template<typename F = float> constexpr F to_float(const q16_t x)
+{
+    static_assert(std::is_floating_point<F>::value, "F must be floating point number");
+    return static_cast<F>(x) / F{65536};
+}
+
+///@cond 0
+namespace detail
+{
+using q30_t = std::int64_t; // Q30 for intermediate values
+constexpr q30_t one30 = q30_t{1} << 30;
+
+constexpr q30_t to30(const q16_t x) { return static_cast<q30_t>(x) * (q30_t{1} << 14); }
+constexpr q16_t to16(const q30_t x) { return static_cast<q16_t>((x + (q30_t{1} << 13)) >> 14); }
+constexpr q30_t from_ld(const long double x) { return static_cast<q30_t>(x * one30 + (x < 0 ? -0.5L : 0.5L)); }
+
+// Products of Q30 (|a * b| must be less than 2^63)
+constexpr q30_t mul(const q30_t a, const q30_t b) { return (a * b + (q30_t{1} << 29)) >> 30; }
+constexpr q30_t sq(const q30_t a) { return mul(a, a); }
+constexpr q30_t half(const q30_t a) { return (a + 1) >> 1; }
+
+// Right shift with rounding
+constexpr q30_t shift_round(const q30_t x, const int s)
+{
+    return s <= 0 ? x * (q30_t{1} << -s) : s >= 62 ? 0 : (x + (q30_t{1} << (s - 1))) >> s;
+}
+
+// Integer square root (rounded) by digit-by-digit method, unrolled by the template
+template<int Bit> constexpr std::uint64_t isqrt_step(const std::uint64_t n, const std::uint64_t r)
+{
+    return n >= r + (std::uint64_t{1} << Bit) ?
+            isqrt_step<Bit - 2>(n - r - (std::uint64_t{1} << Bit), (r >> 1) + (std::uint64_t{1} << Bit)) :
+            isqrt_step<Bit - 2>(n, r >> 1);
+}
+template<> constexpr std::uint64_t isqrt_step<-2>(const std::uint64_t n, const std::uint64_t r) { return n > r ? r + 1 : r; }
+// sqrt of Q60 is Q30
+constexpr q30_t sqrt60(const std::uint64_t n) { return static_cast<q30_t>(isqrt_step<62>(n, 0)); }
+// sqrt(1 - u^2) (0 if |u| >= 1)
+constexpr q30_t sqrt_1_minus_sq(const q30_t u)
+{
+    return (u <= -one30 || u >= one30) ? 0 : sqrt60(static_cast<std::uint64_t>(one30 * one30 - u * u));
+}
+
+// sin(pi/2 * z), z in [0, 1] (Taylor series up to z^11, the last coefficient makes sin(pi/2) exact, error 6e-8)
+constexpr q30_t sin_quarter2(const q30_t z, const q30_t z2)
+{
+    return mul(z, 1686629713 + mul(z2, -693598668 + mul(z2, 85569306 + mul(z2, -5026995 + mul(z2, 172272 + mul(z2, -3804))))));
+}
+constexpr q30_t sin_quarter(const q30_t z) { return sin_quarter2(z, sq(z)); }
+// Angle in turns (2^32 is one turn), so wrap around is free
+constexpr q30_t sin_turn(const std::uint32_t a)
+{
+    return ((a >> 31) ? -1 : 1) *
+            sin_quarter(((a >> 30) & 1) ? one30 - static_cast<q30_t>(a & 0x3FFFFFFFU) : static_cast<q30_t>(a & 0x3FFFFFFFU));
+}
+constexpr q30_t cos_turn(const std::uint32_t a) { return sin_turn(a + 0x40000000U); }
+
+// Angle (r * x + o) in turns
+// M = r * 2^30 (x is Q30, |x * M| must be less than 2^63), O = o * 2^32
+constexpr q30_t turn_mul(const std::int64_t num, const std::int64_t den) { return (num * one30 + den / 2) / den; }
+constexpr std::uint32_t turn_add(const std::int64_t num, const std::int64_t den)
+{
+    return static_cast<std::uint32_t>(static_cast<std::uint64_t>(num * (std::int64_t{1} << 32) / den));
+}
+constexpr std::uint32_t turn(const q30_t x, const q30_t m, const std::uint32_t o)
+{
+    return static_cast<std::uint32_t>(static_cast<std::uint64_t>((x * m) >> 28)) + o;
+}
+
+// 2^f, f in [0, 1) (Taylor series of e^(f ln2) up to f^9, error 7e-9)
+constexpr q30_t exp2_frac(const q30_t f)
+{
+    return one30 + mul(f, 744261118 + mul(f, 257941248 + mul(f, 59597083 + mul(f, 10327387 +
+            mul(f, 1431680 + mul(f, 165394 + mul(f, 16377 + mul(f, 1419 + mul(f, 109)))))))));
+}
+// 2^x (x < 32)
+constexpr q30_t exp2(const q30_t x) { return shift_round(exp2_frac(x & (one30 - 1)), -static_cast<int>(x >> 30)); }
+
+// Derived constants in Q30
+constexpr q30_t back_c1 = from_ld(constants::derived<long double>::back_c1);
+constexpr q30_t back_c3 = from_ld(constants::derived<long double>::back_c3);
+constexpr q30_t back_c2 = from_ld(constants::derived<long double>::back_c2);
+constexpr q30_t back_c2_1 = from_ld(constants::derived<long double>::back_c2_1);
+
+// Curves in Q30
+constexpr q30_t linear(const q30_t t) { return t; }
+
+constexpr q30_t inSinusoidal(const q30_t t) { return one30 - cos_turn(static_cast<std::uint32_t>(t)); }
+constexpr q30_t outSinusoidal(const q30_t t) { return sin_turn(static_cast<std::uint32_t>(t)); }
+constexpr q30_t inOutSinusoidal(const q30_t t) { return half(one30 - cos_turn(static_cast<std::uint32_t>(t * 2))); }
+
+// InOut with t2 = t * 2 (in: f(t2) / 2, out: 1 - g(t2 - 2) / 2)
+constexpr q30_t inQuadratic(const q30_t t) { return sq(t); }
+constexpr q30_t outQuadratic(const q30_t t) { return mul(t, 2 * one30 - t); }
+constexpr q30_t inOutQuadratic2(const q30_t t2) { return t2 < one30 ? half(sq(t2)) : one30 - half(sq(t2 - 2 * one30)); }
+constexpr q30_t inOutQuadratic(const q30_t t) { return inOutQuadratic2(t * 2); }
+
+constexpr q30_t inCubic(const q30_t t) { return mul(sq(t), t); }
+constexpr q30_t outCubic(const q30_t t) { return inCubic(t - one30) + one30; }
+constexpr q30_t inOutCubic2(const q30_t t2) { return t2 < one30 ? half(inCubic(t2)) : half(inCubic(t2 - 2 * one30)) + one30; }
+constexpr q30_t inOutCubic(const q30_t t) { return inOutCubic2(t * 2); }
+
+constexpr q30_t inQuartic(const q30_t t) { return sq(sq(t)); }
+constexpr q30_t outQuartic(const q30_t t) { return one30 - inQuartic(t - one30); }
+constexpr q30_t inOutQuartic2(const q30_t t2) { return t2 < one30 ? half(inQuartic(t2)) : one30 - half(inQuartic(t2 - 2 * one30)); }
+constexpr q30_t inOutQuartic(const q30_t t) { return inOutQuartic2(t * 2); }
+
+constexpr q30_t inQuintic(const q30_t t) { return mul(sq(sq(t)), t); }
+constexpr q30_t outQuintic(const q30_t t) { return inQuintic(t - one30) + one30; }
+constexpr q30_t inOutQuintic2(const q30_t t2) { return t2 < one30 ? half(inQuintic(t2)) : half(inQuintic(t2 - 2 * one30)) + one30; }
+constexpr q30_t inOutQuintic(const q30_t t) { return inOutQuintic2(t * 2); }
+
+constexpr q30_t inExponential(const q30_t t) { return t <= 0 ? 0 : exp2(10 * (t - one30)); }
+constexpr q30_t outExponential(const q30_t t) { return t >= one30 ? one30 : one30 - exp2(-10 * t); }
+constexpr q30_t inOutExponential2(const q30_t e) { return e < 0 ? half(exp2(e)) : one30 - half(exp2(-e)); }
+constexpr q30_t inOutExponential(const q30_t t)
+{
+    return t <= 0 ? 0 : t >= one30 ? one30 : inOutExponential2(10 * (t * 2 - one30));
+}
+
+constexpr q30_t inCircular(const q30_t t) { return one30 - sqrt_1_minus_sq(t); }
+constexpr q30_t outCircular(const q30_t t) { return sqrt_1_minus_sq(t - one30); }
+constexpr q30_t inOutCircular2(const q30_t t2)
+{
+    return t2 < one30 ? half(one30 - sqrt_1_minus_sq(t2)) : half(sqrt_1_minus_sq(t2 - 2 * one30) + one30);
+}
+constexpr q30_t inOutCircular(const q30_t t) { return inOutCircular2(t * 2); }
+
+constexpr q30_t inBack(const q30_t t) { return mul(sq(t), mul(back_c3, t) - back_c1); }
+constexpr q30_t outBack(const q30_t t) { return mul(sq(t - one30), mul(back_c3, t - one30) + back_c1) + one30; }
+constexpr q30_t inOutBack2(const q30_t t2)
+{
+    return t2 < one30 ? half(mul(sq(t2), mul(back_c2_1, t2) - back_c2))
+            : half(mul(sq(t2 - 2 * one30), mul(back_c2_1, t2 - 2 * one30) + back_c2) + 2 * one30);
+}
+constexpr q30_t inOutBack(const q30_t t) { return inOutBack2(t * 2); }
+
+// sin((10t - 10.75) * 2pi/3) = sin((10t - 10.75) / 3 turns)
+constexpr q30_t inElastic(const q30_t t)
+{
+    return t <= 0 ? 0 : t >= one30 ? one30 :
+            -mul(exp2(10 * (t - one30)), sin_turn(turn(t, turn_mul(10, 3), turn_add(-43, 12))));
+}
+// sin((10t - 0.75) * 2pi/3) = sin((10t - 0.75) / 3 turns)
+constexpr q30_t outElastic(const q30_t t)
+{
+    return t <= 0 ? 0 : t >= one30 ? one30 :
+            mul(exp2(-10 * t), sin_turn(turn(t, turn_mul(10, 3), turn_add(-1, 4)))) + one30;
+}
+// sin((20t - 11.125) * 2pi/4.5) = sin((40t - 22.25) / 9 turns)
+constexpr q30_t inOutElastic2(const q30_t t, const q30_t s)
+{
+    return t * 2 < one30 ? -half(mul(exp2(20 * t - 10 * one30), s)) : half(mul(exp2(-20 * t + 10 * one30), s)) + one30;
+}
+constexpr q30_t inOutElastic(const q30_t t)
+{
+    return t <= 0 ? 0 : t >= one30 ? one30 :
+            inOutElastic2(t, sin_turn(turn(t, turn_mul(40, 9), turn_add(-89, 36))));
+}
+
+// n1 * t^2 = (2.75t)^2, breakpoints and offsets are multiples of 1/4 in x = 2.75t
+constexpr q30_t outBounce2(const q30_t x)
+{
+    return x < one30 ? sq(x) :
+            x < 2 * one30 ? sq(x - (3 * one30 / 2)) + (3 * one30 / 4) :
+            x < 5 * one30 / 2 ? sq(x - (9 * one30 / 4)) + (15 * one30 / 16) :
+            sq(x - (21 * one30 / 8)) + (63 * one30 / 64);
+}
+constexpr q30_t outBounce(const q30_t t) { return outBounce2((11 * t + 2) >> 2); }
+constexpr q30_t inBounce(const q30_t t) { return one30 - outBounce(one30 - t); }
+constexpr q30_t inOutBounce(const q30_t t)
+{
+    return t * 2 < one30 ? half(one30 - outBounce(one30 - t * 2)) : half(one30 + outBounce(t * 2 - one30));
+}
+
+// Exact curves in Q16.16 (the exact value is rounded once, no intermediate rounding)
+// Bounce: x = 2.75t = 11t / 4, (x - a)^2 + c = (11t - 4a)^2 / 16 + c
+// With t = n / 2^16, the value in units of 2^-36 is an integer (4a * 2^16 and c * 2^36 are integers)
+constexpr std::int64_t outBounce36_2(const std::int64_t m)
+{
+    return m < 4 * 65536 ? m * m :
+            m < 8 * 65536 ? (m - 6 * 65536) * (m - 6 * 65536) + (std::int64_t{3} << 34) :
+            m < 10 * 65536 ? (m - 9 * 65536) * (m - 9 * 65536) + (std::int64_t{15} << 32) :
+            (m - 21 * 32768) * (m - 21 * 32768) + (std::int64_t{63} << 30);
+}
+constexpr std::int64_t outBounce36(const q16_t n) { return outBounce36_2(11 * static_cast<std::int64_t>(n)); }
+constexpr std::int64_t one36 = std::int64_t{1} << 36;
+constexpr q16_t round36(const std::int64_t v, const int s) { return static_cast<q16_t>((v + (std::int64_t{1} << (s - 1))) >> s); }
+
+// Back: c1 and c2 are approximated by k / 2^24 (error below 1.2e-8), c3 = c1 + 1 and c2_1 = c2 + 1 exactly
+constexpr std::int64_t back_k1 = shift_round(back_c1, 6);
+constexpr std::int64_t back_k3 = back_k1 + (std::int64_t{1} << 24);
+constexpr std::int64_t back_k2 = shift_round(back_c2, 6);
+constexpr std::int64_t back_k2_1 = back_k2 + (std::int64_t{1} << 24);
+// round(m^2 * (kh * m + kl * 2^16) / 2^S), the 80-bit product m * (m * w) is split at bit 32
+constexpr q16_t back_round2(const std::int64_t a, const std::int64_t m, const int s)
+{
+    return static_cast<q16_t>(((a >> 32) * m + (((a & 0xFFFFFFFF) * m) >> 32) + (std::int64_t{1} << (s - 33))) >> (s - 32));
+}
+constexpr q16_t back_round(const std::int64_t m, const std::int64_t kh, const std::int64_t kl, const int s)
+{
+    return back_round2(m * (kh * m + kl * 65536), m, s);
+}
+//
+}
+///@endcond
+
+///@name Easing behavior (Q16.16)
+///@{
+/// @brief Linear
+constexpr q16_t linear(const q16_t t) { return t; }
+/// @brief Ease in sinusoidal
+constexpr q16_t inSinusoidal(const q16_t t) { return detail::to16(detail::inSinusoidal(detail::to30(t))); }
+/// @brief Ease out sinusoidal
+constexpr q16_t outSinusoidal(const q16_t t) { return detail::to16(detail::outSinusoidal(detail::to30(t))); }
+/// @brief Ease inout sinusoidal
+constexpr q16_t inOutSinusoidal(const q16_t t) { return detail::to16(detail::inOutSinusoidal(detail::to30(t))); }
+/// @brief Ease in quadratic
+constexpr q16_t inQuadratic(const q16_t t) { return detail::to16(detail::inQuadratic(detail::to30(t))); }
+/// @brief Ease out quadratic
+constexpr q16_t outQuadratic(const q16_t t) { return detail::to16(detail::outQuadratic(detail::to30(t))); }
+/// @brief Ease inout quadratic
+constexpr q16_t inOutQuadratic(const q16_t t) { return detail::to16(detail::inOutQuadratic(detail::to30(t))); }
+/// @brief Ease in cubic
+constexpr q16_t inCubic(const q16_t t) { return detail::to16(detail::inCubic(detail::to30(t))); }
+/// @brief Ease out cubic
+constexpr q16_t outCubic(const q16_t t) { return detail::to16(detail::outCubic(detail::to30(t))); }
+/// @brief Ease inout cubic
+constexpr q16_t inOutCubic(const q16_t t) { return detail::to16(detail::inOutCubic(detail::to30(t))); }
+/// @brief Ease in quartic
+constexpr q16_t inQuartic(const q16_t t) { return detail::to16(detail::inQuartic(detail::to30(t))); }
+/// @brief Ease out quartic
+constexpr q16_t outQuartic(const q16_t t) { return detail::to16(detail::outQuartic(detail::to30(t))); }
+/// @brief Ease inout quartic
+constexpr q16_t inOutQuartic(const q16_t t) { return detail::to16(detail::inOutQuartic(detail::to30(t))); }
+/// @brief Ease in quintic
+constexpr q16_t inQuintic(const q16_t t) { return detail::to16(detail::inQuintic(detail::to30(t))); }
+/// @brief Ease out quintic
+constexpr q16_t outQuintic(const q16_t t) { return detail::to16(detail::outQuintic(detail::to30(t))); }
+/// @brief Ease inout quintic
+constexpr q16_t inOutQuintic(const q16_t t) { return detail::to16(detail::inOutQuintic(detail::to30(t))); }
+/// @brief Ease in exponential
+constexpr q16_t inExponential(const q16_t t) { return detail::to16(detail::inExponential(detail::to30(t))); }
+/// @brief Ease out exponential
+constexpr q16_t outExponential(const q16_t t) { return detail::to16(detail::outExponential(detail::to30(t))); }
+/// @brief Ease inout exponential
+constexpr q16_t inOutExponential(const q16_t t) { return detail::to16(detail::inOutExponential(detail::to30(t))); }
+/// @brief Ease in circular
+constexpr q16_t inCircular(const q16_t t) { return detail::to16(detail::inCircular(detail::to30(t))); }
+/// @brief Ease out circular
+constexpr q16_t outCircular(const q16_t t) { return detail::to16(detail::outCircular(detail::to30(t))); }
+/// @brief Ease inout circular
+constexpr q16_t inOutCircular(const q16_t t) { return detail::to16(detail::inOutCircular(detail::to30(t))); }
+/// @brief Ease in back
+constexpr q16_t inBack(const q16_t t) { return detail::back_round(t, detail::back_k3, -detail::back_k1, 56); }
+/// @brief Ease out back
+constexpr q16_t outBack(const q16_t t) { return one + detail::back_round(static_cast<std::int64_t>(t) - one, detail::back_k3, detail::back_k1, 56); }
+/// @brief Ease inout back
+constexpr q16_t inOutBack(const q16_t t)
+{
+    return t < half ? detail::back_round(2 * static_cast<std::int64_t>(t), detail::back_k2_1, -detail::back_k2, 57)
+            : one + detail::back_round(2 * (static_cast<std::int64_t>(t) - one), detail::back_k2_1, detail::back_k2, 57);
+}
+/// @brief Ease in elastic
+constexpr q16_t inElastic(const q16_t t) { return detail::to16(detail::inElastic(detail::to30(t))); }
+/// @brief Ease out elastic
+constexpr q16_t outElastic(const q16_t t) { return detail::to16(detail::outElastic(detail::to30(t))); }
+/// @brief Ease inout elastic
+constexpr q16_t inOutElastic(const q16_t t) { return detail::to16(detail::inOutElastic(detail::to30(t))); }
+/// @brief Ease in bounce
+constexpr q16_t inBounce(const q16_t t) { return detail::round36(detail::one36 - detail::outBounce36(one - t), 20); }
+/// @brief Ease out bounce
+constexpr q16_t outBounce(const q16_t t) { return detail::round36(detail::outBounce36(t), 20); }
+/// @brief Ease inout bounce
+constexpr q16_t inOutBounce(const q16_t t)
+{
+    return t < half ? detail::round36(detail::one36 - detail::outBounce36(one - 2 * t), 21)
+            : detail::round36(detail::one36 + detail::outBounce36(2 * t - one), 21);
+}
+///@}
+///@cond 0
+namespace detail
+{
+#if defined(GOBLIB_EASING_BUILTIN_CLZ)
+constexpr int clz32(const std::uint32_t x) { return x ? __builtin_clz(x) : 32; }
+#else
+constexpr int clz32(const std::uint32_t x, const int n = 0) { return (n >= 32 || (x & 0x80000000U)) ? n : clz32(x << 1, n + 1); }
+#endif
+constexpr std::uint32_t normalize(const std::uint32_t d) { return d ? d << clz32(d) : 0; }
+
+// inv = floor((2^63 - 1) / d) for d normalized, without division
+// Linear estimate 2^31 * (48 - 32 * d / 2^32) / 17 (relative error < 1/17), 3 Newton steps (< 2^-32) and at most 2 corrections
+constexpr std::uint64_t inverse_newton(const std::uint64_t d, const std::uint64_t x)
+{
+    return x + static_cast<std::uint64_t>((static_cast<std::int64_t>(x) * (static_cast<std::int64_t>(0x8000000000000000ULL - d * x) >> 31)) >> 32);
+}
+constexpr std::uint32_t inverse_fix(const std::uint64_t d, const std::uint64_t x, const std::int64_t r)
+{
+    return r < 0 ? inverse_fix(d, x - 1, r + static_cast<std::int64_t>(d)) :
+            r >= static_cast<std::int64_t>(d) ? inverse_fix(d, x + 1, r - static_cast<std::int64_t>(d)) : static_cast<std::uint32_t>(x);
+}
+constexpr std::uint32_t inverse_of(const std::uint64_t d, const std::uint64_t x)
+{
+    return inverse_fix(d, x, static_cast<std::int64_t>(0x7FFFFFFFFFFFFFFFULL - d * x));
+}
+constexpr std::uint32_t inverse(const std::uint32_t d)
+{
+    return inverse_of(d, inverse_newton(d, inverse_newton(d, inverse_newton(d, 6063412150ULL - ((static_cast<std::uint64_t>(d) * 2021161080ULL) >> 31)))));
+}
+
+// q = floor(n / d) for n < 2^49, d normalized, inv = floor((2^63 - 1) / d) (The estimate is q or q - 1)
+constexpr std::uint64_t div_fix(const std::uint64_t n, const std::uint32_t d, const std::uint64_t q)
+{
+    return q + ((n - q * d) >= d);
+}
+constexpr std::uint64_t div_inv(const std::uint64_t n, const std::uint32_t d, const std::uint32_t inv)
+{
+    return div_fix(n, d, ((n >> 17) * inv) >> 46);
+}
+
+// round(n / d) in Q16.16 for n < d by one division (32-bit while n < 2^16), q and r of n * 2^16 / d
+template<typename U> constexpr q16_t ratio_qr(const U q, const U r, const U d) { return static_cast<q16_t>(q + (r >= d - r)); }
+template<typename U> constexpr q16_t ratio_n(const U n16, const U d) { return ratio_qr<U>(n16 / d, n16 % d, d); }
+constexpr q16_t ratio(const std::uint32_t n, const std::uint32_t d)
+{
+    return n >= d ? one :
+            n < 0x10000U ? ratio_n<std::uint32_t>(n << 16, d) : ratio_n<std::uint64_t>(static_cast<std::uint64_t>(n) << 16, d);
+}
+
+// from + (to - from) * c, rounded to nearest (half up) and saturated
+constexpr std::int32_t saturate32(const std::int64_t v)
+{
+    return static_cast<std::int32_t>(v < std::numeric_limits<std::int32_t>::min() ? std::numeric_limits<std::int32_t>::min() :
+                                     v > std::numeric_limits<std::int32_t>::max() ? std::numeric_limits<std::int32_t>::max() : v);
+}
+constexpr std::int32_t lerp(const std::int32_t from, const std::int32_t to, const q16_t c)
+{
+    return saturate32(from + (((static_cast<std::int64_t>(to) - from) * c + (std::int64_t{1} << 15)) >> 16));
+}
+constexpr std::int32_t saturate16(const std::int32_t v)
+{
+    return v < std::numeric_limits<std::int16_t>::min() ? std::numeric_limits<std::int16_t>::min() :
+            v > std::numeric_limits<std::int16_t>::max() ? std::numeric_limits<std::int16_t>::max() : v;
+}
+//
+}
+///@endcond
+
+/*!
+  @brief Reciprocal of the duration
+  @details Computes elapsed / duration by multiplications only.
+  The constructor has no division either (linear estimate, Newton steps and a correction), but costs more than ratio,
+  so keep the object for a fixed duration.
+ */
+struct reciprocal
+{
+    std::uint32_t divisor; //!< Duration
+    std::uint32_t normalized; //!< divisor << shift (MSB is set)
+    std::uint32_t inverse; //!< floor((2^63 - 1) / normalized)
+    int shift; //!< Normalization shift
+
+    constexpr reciprocal(const std::uint32_t d)
+            : divisor{d}, normalized{detail::normalize(d)},
+              inverse{d ? detail::inverse(detail::normalize(d)) : 0U},
+              shift{d ? detail::clz32(d) : 0} {}
+
+    /*!
+      @brief Ratio in Q16.16
+      @return round(n / divisor) (one if n >= divisor)
+     */
+    constexpr q16_t ratio(const std::uint32_t n) const
+    {
+        return n >= divisor ? one :
+                static_cast<q16_t>(detail::div_inv((static_cast<std::uint64_t>(n << shift) << 16) + (normalized >> 1), normalized, inverse));
+    }
+};
+
+/*!
+  @brief Ease between integers by integer time
+  @tparam Curve Easing behavior (e.g. fx::inOutCubic)
+  @param elapsed Elapsed time (Clamped to duration)
+  @param duration Reciprocal of the duration (Keep it for a fixed duration)
+  @param from Value at the start
+  @param to Value at the end
+  @return from + (to - from) * Curve(elapsed / duration), rounded to nearest and saturated
+  @note No floating point and no division per call.
+  @code
+  constexpr goblib::easing::fx::reciprocal dur{1500}; // ms
+  std::int32_t x = goblib::easing::fx::ease_int<goblib::easing::fx::outBounce>(millis() - start, dur, 0, 320);
+  @endcode
+ */
+template<q16_t (*Curve)(const q16_t)>
+constexpr std::int32_t ease_int(const std::uint32_t elapsed, const reciprocal duration, const std::int32_t from, const std::int32_t to)
+{
+    return detail::lerp(from, to, Curve(duration.ratio(elapsed)));
+}
+/*!
+  @brief Ease between integers by integer time, for a duration that changes per call
+  @note One integer division per call, 32-bit while elapsed < 65536 (65 seconds in milliseconds), otherwise 64-bit.
+  Same result as the reciprocal overload, which is faster for a fixed duration.
+ */
+template<q16_t (*Curve)(const q16_t)>
+constexpr std::int32_t ease_int(const std::uint32_t elapsed, const std::uint32_t duration, const std::int32_t from, const std::int32_t to)
+{
+    return detail::lerp(from, to, Curve(detail::ratio(elapsed, duration)));
+}
+
+///@name Pixel coordinates
+///@{
+/*!
+  @brief Eased value to a pixel coordinate
+  @param e Eased value in Q16.16 (e.g. fx::outBounce(t))
+  @param from Coordinate at 0.0
+  @param to Coordinate at 1.0
+  @return from + (to - from) * e, rounded to nearest (half up) and saturated to std::int16_t
+  @note One multiplication and shift.
+ */
+constexpr std::int16_t to_pixel(const q16_t e, const std::int16_t from, const std::int16_t to)
+{
+    return static_cast<std::int16_t>(detail::saturate16(detail::lerp(from, to, e)));
+}
+/*!
+  @brief Eased values to pixel coordinates
+  @param e Eased values in Q16.16
+  @param out Coordinates
+  @param n Number of elements
+  @param from Coordinate at 0.0
+  @param to Coordinate at 1.0
+ */
+inline void to_pixels(const q16_t* e, std::int16_t* out, const std::size_t n, const std::int16_t from, const std::int16_t to)
+{
+    for(std::size_t i = 0; i < n; ++i) { out[i] = to_pixel(e[i], from, to); }
+}
+/*!
+  @brief Plot the curve to pixel coordinates
+  @details out[i] = to_pixel(Curve(i / (n - 1)), from, to)
+  @tparam Curve Easing behavior (e.g. fx::inOutCubic)
+  @param out Coordinates (n elements)
+  @param n Number of points (2 or more)
+  @param from Coordinate at 0.0 (e.g. bottom of the graph)
+  @param to Coordinate at 1.0 (e.g. top of the graph)
+  @code
+  std::int16_t y[wid + 1];
+  goblib::easing::fx::plot<goblib::easing::fx::outBounce>(y, wid + 1, bottom, top);
+  @endcode
+ */
+template<q16_t (*Curve)(const q16_t)> inline void plot(std::int16_t* out, const std::size_t n, const std::int16_t from, const std::int16_t to)
+{
+    const reciprocal r{static_cast<std::uint32_t>(n > 1 ? n - 1 : 1)};
+    for(std::size_t i = 0; i < n; ++i) { out[i] = to_pixel(Curve(r.ratio(static_cast<std::uint32_t>(i))), from, to); }
+}
+///@}
+
+///@cond 0
+namespace detail
+{
+// Index sequence for C++11 (logarithmic instantiation depth)
+template<std::size_t... I> struct index_sequence {};
+template<class A, class B> struct concat_sequence;
+template<std::size_t... A, std::size_t... B> struct concat_sequence<index_sequence<A...>, index_sequence<B...>>
+{
+    using type = index_sequence<A..., (sizeof...(A) + B)...>;
+};
+template<std::size_t N> struct make_sequence
+{
+    using type = typename concat_sequence<typename make_sequence<N / 2>::type, typename make_sequence<N - N / 2>::type>::type;
+};
+template<> struct make_sequence<0> { using type = index_sequence<>; };
+template<> struct make_sequence<1> { using type = index_sequence<0>; };
+
+// Clamp to [0, 1], gamma correction and quantization to [0, 255]
+template<class Gamma> constexpr std::uint8_t gamma8(const double v)
+{
+    return static_cast<std::uint8_t>(255.0 * (v <= 0.0 ? 0.0 : v >= 1.0 ? 1.0 :
+            Gamma::num == Gamma::den ? v : math::pow(v, static_cast<double>(Gamma::num) / static_cast<double>(Gamma::den))) + 0.5);
+}
+template<double (*Curve)(const double), class Gamma, class Seq> struct gamma_table_value;
+template<double (*Curve)(const double), class Gamma, std::size_t... I> struct gamma_table_value<Curve, Gamma, index_sequence<I...>>
+{
+    static constexpr std::uint8_t value[sizeof...(I)] = { gamma8<Gamma>(Curve(static_cast<double>(I) / static_cast<double>(sizeof...(I) - 1)))... };
+};
+template<double (*Curve)(const double), class Gamma, std::size_t... I>
+constexpr std::uint8_t gamma_table_value<Curve, Gamma, index_sequence<I...>>::value[sizeof...(I)];
+//
+}
+///@endcond
+
+/*!
+  @brief 8-bit table of easing, gamma correction and quantization
+  @details Entry i is round(255 * Curve(i / (N - 1))^Gamma), computed at compile time.
+  One lookup per LED per frame replaces the curve, gamma correction and quantization.
+  @tparam Curve Easing behavior (e.g. goblib::easing::inOutSinusoidal<double>)
+  @tparam N Number of frames (2 - 65536)
+  @tparam Gamma Gamma as std::ratio (std::ratio<1> for no correction)
+  @note Overshoot of Back and Elastic is clamped to [0, 1].
+  @code
+  using fade = goblib::easing::fx::gamma_table<goblib::easing::inOutSinusoidal<double>, 120>;
+  fade::transform(frame_of_each_led, pwm, num_leds);
+  @endcode
+ */
+template<double (*Curve)(const double), std::size_t N = 256, class Gamma = std::ratio<22, 10>>
+struct gamma_table
+{
+    static_assert(N > 1 && N <= 65536, "N must be 2 - 65536");
+    static_assert(Gamma::num > 0, "Gamma must be positive");
+
+    using index_type = typename std::conditional<N <= 256, std::uint8_t, std::uint16_t>::type; //!< Frame
+    static constexpr std::size_t size = N; //!< Number of frames
+
+    /// @brief Table
+    static constexpr const std::uint8_t* data() { return detail::gamma_table_value<Curve, Gamma, typename detail::make_sequence<N>::type>::value; }
+    /// @brief Value of the frame (clamped to N - 1)
+    static constexpr std::uint8_t at(const std::size_t frame) { return data()[frame < N ? frame : N - 1]; }
+    /*!
+      @brief Value of each frame
+      @param frame Frames (clamped to N - 1)
+      @param out Values
+      @param n Number of elements
+     */
+    static void transform(const index_type* frame, std::uint8_t* out, const std::size_t n)
+    {
+        const std::uint8_t* tbl = data();
+        for(std::size_t i = 0; i < n; ++i) { out[i] = tbl[frame[i] < N ? frame[i] : N - 1]; }
+    }
+};
+///@cond 0
+template<double (*Curve)(const double), std::size_t N, class Gamma> constexpr std::size_t gamma_table<Curve, N, Gamma>::size;
+///@endcond
+
+/*!
+  @namespace goblib::easing::fx::q15
+  @brief Q1.15 easing functions for block based processing
+  @details Phase and result are Q1.15 in std::int16_t (t = phase / 32768).
+  1.0 is not representable and saturates to 32767. The phase is clamped to [0, 32767].
+  Only the monotonic curves (linear, Sinusoidal, polynomials, Exponential, Circular) are provided.
+  Products follow pmulhrsw, (a * b + 0x4000) >> 15 of int16 operands,
+  and the per sample functions are selects without loops, so transform and ramp can be auto-vectorized
+  (GCC -O3 -mavx2 vectorizes all but Exponential).
+  @note All functions are constexpr (C++11).
+
+  Maximum error in LSB (1 / 32768) against the double template for all 32768 phases.
+  Results are monotonic except for rounding noise of 1 LSB.
+  |Curve|in|out|inOut|
+  |---|---:|---:|---:|
+  |linear|0.00|-|-|
+  |Sinusoidal|2.60|2.02|1.73|
+  |Quadratic|0.50|0.50|0.75|
+  |Cubic|0.96|0.96|0.98|
+  |Quartic|1.42|1.42|1.19|
+  |Quintic|1.74|1.74|1.37|
+  |Exponential|1.65|1.65|1.31|
+  |Circular|0.50|0.50|0.75|
+  @sa test/test_fixed.cpp (q15.precision prints the table)
+*/
+namespace q15
+{
+using q15_t = std::int16_t; //!< Q1.15
+constexpr q15_t one = 32767; //!< Saturated 1.0
+constexpr q15_t half = 16384; //!< 0.5
+
+///@cond 0
+namespace detail
+{
+using i32 = std::int32_t;
+constexpr i32 unit = 32768;
+
+constexpr i32 clamp(const i32 x) { return x < 0 ? 0 : x > one ? one : x; }
+constexpr std::int64_t saturate(const std::int64_t x) { return x < -32768 ? -32768 : x > one ? one : x; }
+// Product as pmulhrsw (a and b are in int16)
+constexpr i32 mul(const i32 a, const i32 b) { return (a * b + 0x4000) >> 15; }
+// a * b + c * d with one rounding as pmaddwd
+constexpr i32 mul_add(const i32 a, const i32 b, const i32 c, const i32 d) { return (a * b + c * d + 0x4000) >> 15; }
+constexpr i32 halve(const i32 x) { return (x + 1) >> 1; }
+
+// Integer square root of Q30 (rounded, fully unrolled)
+template<int Bit> constexpr std::uint32_t isqrt_step(const std::uint32_t n, const std::uint32_t r)
+{
+    return n >= r + (std::uint32_t{1} << Bit) ?
+            isqrt_step<Bit - 2>(n - r - (std::uint32_t{1} << Bit), (r >> 1) + (std::uint32_t{1} << Bit)) :
+            isqrt_step<Bit - 2>(n, r >> 1);
+}
+template<> constexpr std::uint32_t isqrt_step<-2>(const std::uint32_t n, const std::uint32_t r) { return n > r ? r + 1 : r; }
+constexpr i32 sqrt30(const std::uint32_t n) { return static_cast<i32>(isqrt_step<30>(n, 0)); }
+
+// sin(pi/2 * x) = x + x * p(x^2) (Taylor series up to x^9)
+constexpr i32 sin_quarter(const i32 x, const i32 x2)
+{
+    return x + mul(x, 18704 - mul(x2, 21167 - mul(x2, 2611 - mul(x2, 153 - mul(x2, 5)))));
+}
+// 1 - cos(pi/2 * x) = x^2 + x^2 * p(x^2) (Taylor series up to x^10)
+constexpr i32 versin_quarter(const i32 x, const i32 x2)
+{
+    return mul_add(x, x, x2, 7658 - mul(x2, 8312 - mul(x2, 684 - mul(x2, 30 - mul(x2, 1)))));
+}
+// 2^-f (Taylor series of e^(-f ln2) up to f^6)
+constexpr i32 exp2_neg_frac(const i32 f)
+{
+    return unit - mul(f, 22713 - mul(f, 7872 - mul(f, 1819 - mul(f, 315 - mul(f, 44 - mul(f, 5))))));
+}
+// 2^-(e / 32768), e >= 0
+constexpr i32 exp2_neg(const i32 e) { return (exp2_neg_frac(e & 0x7FFF) + ((1 << (e >> 15)) >> 1)) >> (e >> 15); }
+
+// Ease in on x in [0, 32767] (may return 32768)
+constexpr i32 inQuadratic(const i32 x) { return mul(x, x); }
+constexpr i32 inCubic(const i32 x) { return mul(mul(x, x), x); }
+constexpr i32 inQuartic(const i32 x) { return inQuadratic(mul(x, x)); }
+constexpr i32 inQuintic(const i32 x) { return mul(inQuartic(x), x); }
+constexpr i32 inSinusoidal(const i32 x) { return versin_quarter(x, mul(x, x)); }
+constexpr i32 inExponential(const i32 x) { return x <= 0 ? 0 : exp2_neg(10 * (unit - x)); }
+constexpr i32 inCircular(const i32 x) { return unit - sqrt30(static_cast<std::uint32_t>((1 << 30) - x * x)); }
+
+// out(x) = 1 - in(1 - x), inOut(x) = in(2x) / 2 or 1/2 + out(2x - 1) / 2
+template<i32 (*In)(const i32)> constexpr i32 out(const i32 x) { return x <= 0 ? 0 : unit - In(unit - x); }
+template<i32 (*In)(const i32)> constexpr i32 in_out(const i32 x)
+{
+    return x < q15::half ? halve(In(x * 2)) : q15::half + halve(out<In>(x * 2 - unit));
+}
+// Saturated phase + step * i
+constexpr q15_t clamp64(const std::int64_t x) { return static_cast<q15_t>(x < 0 ? 0 : x > one ? one : x); }
+constexpr q15_t phase_at(const q15_t phase, const q15_t step, const std::size_t i)
+{
+    return clamp64(phase + static_cast<std::int64_t>(step) * static_cast<std::int64_t>(i));
+}
+template<i32 (*F)(const i32)> constexpr q15_t apply(const q15_t t) { return static_cast<q15_t>(clamp(F(clamp(t)))); }
+//
+}
+///@endcond
+
+///@name Easing behavior (Q1.15)
+///@{
+/// @brief Linear
+constexpr q15_t linear(const q15_t t) { return static_cast<q15_t>(detail::clamp(t)); }
+/// @brief Ease in sinusoidal
+constexpr q15_t inSinusoidal(const q15_t t) { return detail::apply<detail::inSinusoidal>(t); }
+/// @brief Ease out sinusoidal
+constexpr q15_t outSinusoidal(const q15_t t)
+{
+    return static_cast<q15_t>(detail::clamp(detail::sin_quarter(detail::clamp(t), detail::mul(detail::clamp(t), detail::clamp(t)))));
+}
+/// @brief Ease inout sinusoidal
+constexpr q15_t inOutSinusoidal(const q15_t t) { return detail::apply<detail::in_out<detail::inSinusoidal>>(t); }
+/// @brief Ease in quadratic
+constexpr q15_t inQuadratic(const q15_t t) { return detail::apply<detail::inQuadratic>(t); }
+/// @brief Ease out quadratic
+constexpr q15_t outQuadratic(const q15_t t) { return detail::apply<detail::out<detail::inQuadratic>>(t); }
+/// @brief Ease inout quadratic
+constexpr q15_t inOutQuadratic(const q15_t t) { return detail::apply<detail::in_out<detail::inQuadratic>>(t); }
+/// @brief Ease in cubic
+constexpr q15_t inCubic(const q15_t t) { return detail::apply<detail::inCubic>(t); }
+/// @brief Ease out cubic
+constexpr q15_t outCubic(const q15_t t) { return detail::apply<detail::out<detail::inCubic>>(t); }
+/// @brief Ease inout cubic
+constexpr q15_t inOutCubic(const q15_t t) { return detail::apply<detail::in_out<detail::inCubic>>(t); }
+/// @brief Ease in quartic
+constexpr q15_t inQuartic(const q15_t t) { return detail::apply<detail::inQuartic>(t); }
+/// @brief Ease out quartic
+constexpr q15_t outQuartic(const q15_t t) { return detail::apply<detail::out<detail::inQuartic>>(t); }
+/// @brief Ease inout quartic
+constexpr q15_t inOutQuartic(const q15_t t) { return detail::apply<detail::in_out<detail::inQuartic>>(t); }
+/// @brief Ease in quintic
+constexpr q15_t inQuintic(const q15_t t) { return detail::apply<detail::inQuintic>(t); }
+/// @brief Ease out quintic
+constexpr q15_t outQuintic(const q15_t t) { return detail::apply<detail::out<detail::inQuintic>>(t); }
+/// @brief Ease inout quintic
+constexpr q15_t inOutQuintic(const q15_t t) { return detail::apply<detail::in_out<detail::inQuintic>>(t); }
+/// @brief Ease in exponential
+constexpr q15_t inExponential(const q15_t t) { return detail::apply<detail::inExponential>(t); }
+/// @brief Ease out exponential
+constexpr q15_t outExponential(const q15_t t) { return detail::apply<detail::out<detail::inExponential>>(t); }
+/// @brief Ease inout exponential
+constexpr q15_t inOutExponential(const q15_t t) { return detail::apply<detail::in_out<detail::inExponential>>(t); }
+/// @brief Ease in circular
+constexpr q15_t inCircular(const q15_t t) { return detail::apply<detail::inCircular>(t); }
+/// @brief Ease out circular
+constexpr q15_t outCircular(const q15_t t) { return detail::apply<detail::out<detail::inCircular>>(t); }
+/// @brief Ease inout circular
+constexpr q15_t inOutCircular(const q15_t t) { return detail::apply<detail::in_out<detail::inCircular>>(t); }
+///@}
+
+///@name Block processing
+///@{
+/*!
+  @brief Apply the curve to each phase
+  @tparam F Curve (e.g. q15::inCubic)
+  @param in Phases
+  @param out Results (may be the same as in)
+  @param n Number of samples (Intended for blocks of 64 - 512 samples)
+ */
+template<q15_t (*F)(const q15_t)> inline void transform(const q15_t* in, q15_t* out, const std::size_t n)
+{
+    for(std::size_t i = 0; i < n; ++i) { out[i] = F(in[i]); }
+}
+/*!
+  @brief Generate an envelope from the linear phase
+  @tparam F Curve (e.g. q15::inCubic)
+  @param out Results
+  @param n Number of samples (Intended for blocks of 64 - 512 samples)
+  @param phase Phase of the first sample
+  @param step Phase increment per sample
+  @return Phase of the next block (saturated)
+ */
+template<q15_t (*F)(const q15_t)> inline q15_t ramp(q15_t* out, const std::size_t n, const q15_t phase, const q15_t step)
+{
+    for(std::size_t i = 0; i < n; ++i) { out[i] = F(detail::phase_at(phase, step, i)); }
+    return detail::phase_at(phase, step, n);
+}
+///@}
+}//
+}//
+///@cond 0
+namespace fx { namespace detail {
+// Tables for the math functions
+template<typename D = void> struct kernel_table
+{
+    static constexpr std::int32_t atan_size = 30;
+    // atan(2^-i) in turns (2^32 is one turn)
+    static constexpr std::uint32_t atan[atan_size] =
+    {
+        536870912, 316933406, 167458907, 85004756, 42667331, 21354465, 10679838, 5340245,
+        2670163, 1335087, 667544, 333772, 166886, 83443, 41722, 20861,
+        10430, 5215, 2608, 1304, 652, 326, 163, 81,
+        41, 20, 10, 5, 3, 1,
+    };
+    static constexpr q30_t cordic_gain = 652032874; // prod(1 / sqrt(1 + 2^-2i)) in Q30
+
+    static constexpr std::int32_t exp2_size = 64; // 2^[0.0 ~ 1.0)
+    // 2^(i / exp2_size) in Q30
+    static constexpr q30_t exp2[exp2_size] =
+    {
+        1073741824, 1085434106, 1097253708, 1109202018, 1121280436, 1133490379, 1145833280, 1158310587,
+        1170923762, 1183674286, 1196563654, 1209593378, 1222764986, 1236080024, 1249540052, 1263146652,
+        1276901417, 1290805962, 1304861917, 1319070932, 1333434672, 1347954824, 1362633090, 1377471191,
+        1392470869, 1407633882, 1422962010, 1438457051, 1454120821, 1469955159, 1485961921, 1502142985,
+        1518500250, 1535035634, 1551751076, 1568648537, 1585730000, 1602997467, 1620452965, 1638098541,
+        1655936265, 1673968228, 1692196547, 1710623359, 1729250827, 1748081133, 1767116489, 1786359126,
+        1805811301, 1825475297, 1845353420, 1865448001, 1885761398, 1906295993, 1927054196, 1948038440,
+        1969251188, 1990694927, 2012372174, 2034285470, 2056437387, 2078830522, 2101467502, 2124350982,
+    };
+};
+template<typename D> constexpr std::uint32_t kernel_table<D>::atan[kernel_table<D>::atan_size];
+template<typename D> constexpr q30_t kernel_table<D>::cordic_gain;
+template<typename D> constexpr q30_t kernel_table<D>::exp2[kernel_table<D>::exp2_size];
+
+// CORDIC rotation of (x, y) by z turns (|z| <= 1/8 turn), I-th to N-th iteration
+// Directions are selected by the sign mask of z, not by branches
+constexpr q30_t negate_if(const q30_t v, const q30_t m) { return (v ^ m) - m; }
+template<int I, int N> struct cordic
+{
+    static constexpr q30_t y_m(const q30_t x, const q30_t y, const std::int64_t z, const q30_t m)
+    {
+        return cordic<I + 1, N>::y(x - negate_if(y >> I, m), y + negate_if(x >> I, m), z - negate_if(kernel_table<>::atan[I], m));
+    }
+    static constexpr q30_t y(const q30_t x, const q30_t y, const std::int64_t z) { return y_m(x, y, z, z >> 63); }
+};
+template<int N> struct cordic<N, N>
+{
+    static constexpr q30_t y(const q30_t, const q30_t y, const std::int64_t) { return y; }
+};
+// sin of the angle in turns (2^32 is one turn) in Q30
+// The start vector is rotated to the nearest quadrant q, and CORDIC rotates the residual angle
+template<int N> constexpr q30_t sin_cordic_q(const std::uint32_t a, const std::uint32_t q)
+{
+    return cordic<0, N>::y(q == 0 ? kernel_table<>::cordic_gain : q == 2 ? -kernel_table<>::cordic_gain : 0,
+                           q == 1 ? kernel_table<>::cordic_gain : q == 3 ? -kernel_table<>::cordic_gain : 0,
+                           static_cast<std::int32_t>(a - (q << 30)));
+}
+template<int N> constexpr q30_t sin_cordic(const std::uint32_t a) { return sin_cordic_q<N>(a, ((a + 0x20000000U) >> 30) & 3); }
+
+// 2^f, f in [0, 1) Q30 by table and 2^r = 1 + r ln2 + (r ln2)^2 / 2 (r < 1/64, error 2e-7)
+constexpr q30_t exp2_table_r(const q30_t v, const q30_t rl) { return v + mul(v, rl + (sq(rl) >> 1)); }
+constexpr q30_t exp2_table(const q30_t f)
+{
+    return exp2_table_r(kernel_table<>::exp2[f >> 24], mul(f & 0xFFFFFF, 744261118));
+}
+//
+}}
+///@endcond
+
+namespace math
+{
+/// @name Fixed-point arithmetic functions
+/// @{
+/*!
+  @brief sin (Q16.16)
+  @param x Radian in Q16.16
+  @return sin(x) in Q16.16 by CORDIC (24 iterations)
+ */
+constexpr fx::q16_t sin_q16(const fx::q16_t x)
+{
+    return fx::detail::to16(fx::detail::sin_cordic<24>(static_cast<std::uint32_t>(static_cast<std::uint64_t>((static_cast<std::int64_t>(x) * 683565276 + 0x8000) >> 16))));
+}
+/// @brief cos (Q16.16)
+constexpr fx::q16_t cos_q16(const fx::q16_t x)
+{
+    return fx::detail::to16(fx::detail::sin_cordic<24>(static_cast<std::uint32_t>(static_cast<std::uint64_t>((static_cast<std::int64_t>(x) * 683565276 + 0x8000) >> 16)) + 0x40000000U));
+}
+/*!
+  @brief 2^x (Q16.16)
+  @param x Exponent in Q16.16
+  @return 2^x in Q16.16 by table and correction (Saturated if x >= 15)
+ */
+constexpr fx::q16_t exp2_q16(const fx::q16_t x)
+{
+    return x >= 15 * fx::one ? std::numeric_limits<fx::q16_t>::max() :
+            static_cast<fx::q16_t>(fx::detail::shift_round(fx::detail::exp2_table(static_cast<fx::detail::q30_t>(x & 0xFFFF) << 14), 14 - (x >> 16)));
+}
+/*!
+  @brief sin (Q1.15)
+  @param x Angle in Q1.15 of pi (-32768 is -pi)
+  @return sin(pi * x) in Q1.15 by CORDIC (20 iterations, 1.0 saturates to 32767)
+ */
+constexpr fx::q15::q15_t sin_q15(const fx::q15::q15_t x)
+{
+    return static_cast<fx::q15::q15_t>(fx::q15::detail::saturate(fx::detail::shift_round(fx::detail::sin_cordic<20>(static_cast<std::uint32_t>(x) << 16), 15)));
+}
+/// @brief cos (Q1.15)
+constexpr fx::q15::q15_t cos_q15(const fx::q15::q15_t x)
+{
+    return static_cast<fx::q15::q15_t>(fx::q15::detail::saturate(fx::detail::shift_round(fx::detail::sin_cordic<20>((static_cast<std::uint32_t>(x) << 16) + 0x40000000U), 15)));
+}
+/*!
+  @brief 2^x (Q1.15)
+  @param x Exponent in Q1.15 [-1.0, 1.0)
+  @return 2^x in Q1.15 by table and correction (Saturated to 32767 if x >= 0)
+ */
+constexpr fx::q15::q15_t exp2_q15(const fx::q15::q15_t x)
+{
+    return x >= 0 ? fx::q15::one :
+            static_cast<fx::q15::q15_t>(fx::detail::shift_round(fx::detail::exp2_table(static_cast<fx::detail::q30_t>(x & 0x7FFF) << 15), 16));
+}
+/// @}
+}//
+}}
+#endif
@@ -0,0 +1,335 @@
+/*!
+  @file gob_easing_fixed_simd.hpp
+  @brief SIMD batch processing of the Q1.15 easing functions (SSE2, AVX2)
+
+  fx::q15 curves for 16 (SSE2) or 32 (AVX2) samples per iteration with integer SIMD only.
+  Results are bit-identical to the scalar functions of gob_easing_fixed.hpp.
+  Falls back to the scalar functions on other targets.
+
+  @copyright 2024 GOB
+  @copyright Licensed under the MIT license. See LICENSE file in the project root for full license information.
+ */
+#ifndef GOB_EASING_FIXED_SIMD_HPP
+#define GOB_EASING_FIXED_SIMD_HPP
+
+#include "gob_easing_fixed.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define GOBLIB_EASING_SIMD_SSE2
+# include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+# define GOBLIB_EASING_SIMD_AVX2
+# include <immintrin.h>
+#endif
+
+namespace goblib { namespace easing { namespace fx { namespace q15 {
+
+/*!
+  @namespace simd
+  @brief SIMD batch processing of the Q1.15 easing functions
+  @details Each curve has a vector kernel that replays the scalar Q1.15 arithmetic lane by lane.
+  Lanes are 16-bit and intermediate values are in [0, 65535], so they are held unsigned.
+  - mul is (a * b + 2^14) >> 15 by pmulhuw and pmullw (exact for the unsigned operands).
+  - mul_add of Sinusoidal is pmaddwd.
+  - Branches become per-lane selects.
+  - The variable shift of Exponential is done bit by bit.
+  - The square root of Circular runs in 32-bit lanes.
+  .
+  Two registers are processed per iteration (16 samples for SSE2, 32 for AVX2). The remainder is scalar.
+  @note test/test_fixed_simd.cpp compares all 65536 arguments with the scalar functions.
+  @code
+  #include <gob_easing_fixed_simd.hpp>
+  namespace q15 = goblib::easing::fx::q15;
+  q15::simd::transform<q15::inOutCubic>(phases, gains, 4096); // AVX2 if enabled (-mavx2), otherwise SSE2
+  @endcode
+*/
+namespace simd
+{
+#if defined(GOBLIB_EASING_SIMD_SSE2)
+/// @brief SSE2 (8 lanes)
+struct sse2
+{
+    using v = __m128i;
+    static constexpr std::size_t lanes = 8; //!< Number of Q1.15 lanes
+
+    ///@cond 0
+    static v load(const q15_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static void store(q15_t* p, const v a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a); }
+    static v set1(const int x) { return _mm_set1_epi16(static_cast<short>(x)); }
+    static v set1_32(const int x) { return _mm_set1_epi32(x); }
+    static v zero() { return _mm_setzero_si128(); }
+    static v and_(const v a, const v b) { return _mm_and_si128(a, b); }
+    static v or_(const v a, const v b) { return _mm_or_si128(a, b); }
+    static v andnot(const v a, const v b) { return _mm_andnot_si128(a, b); } // ~a & b
+    // 16-bit lanes
+    static v add(const v a, const v b) { return _mm_add_epi16(a, b); }
+    static v sub(const v a, const v b) { return _mm_sub_epi16(a, b); }
+    static v subs_u(const v a, const v b) { return _mm_subs_epu16(a, b); }
+    static v max(const v a, const v b) { return _mm_max_epi16(a, b); }
+    static v eq(const v a, const v b) { return _mm_cmpeq_epi16(a, b); }
+    static v gt(const v a, const v b) { return _mm_cmpgt_epi16(a, b); }
+    template<int S> static v sll(const v a) { return _mm_slli_epi16(a, S); }
+    template<int S> static v srl(const v a) { return _mm_srli_epi16(a, S); }
+    static v mulhi_u(const v a, const v b) { return _mm_mulhi_epu16(a, b); }
+    static v mullo(const v a, const v b) { return _mm_mullo_epi16(a, b); }
+    static v unpacklo(const v a, const v b) { return _mm_unpacklo_epi16(a, b); }
+    static v unpackhi(const v a, const v b) { return _mm_unpackhi_epi16(a, b); }
+    static v madd(const v a, const v b) { return _mm_madd_epi16(a, b); }
+    // 32-bit lanes
+    static v add32(const v a, const v b) { return _mm_add_epi32(a, b); }
+    static v sub32(const v a, const v b) { return _mm_sub_epi32(a, b); }
+    static v gt32(const v a, const v b) { return _mm_cmpgt_epi32(a, b); }
+    template<int S> static v srl32(const v a) { return _mm_srli_epi32(a, S); }
+    template<int S> static v sra32(const v a) { return _mm_srai_epi32(a, S); }
+    static v packs32(const v a, const v b) { return _mm_packs_epi32(a, b); }
+    ///@endcond
+};
+#endif
+
+#if defined(GOBLIB_EASING_SIMD_AVX2)
+/// @brief AVX2 (16 lanes)
+struct avx2
+{
+    using v = __m256i;
+    static constexpr std::size_t lanes = 16; //!< Number of Q1.15 lanes
+
+    ///@cond 0
+    static v load(const q15_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void store(q15_t* p, const v a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); }
+    static v set1(const int x) { return _mm256_set1_epi16(static_cast<short>(x)); }
+    static v set1_32(const int x) { return _mm256_set1_epi32(x); }
+    static v zero() { return _mm256_setzero_si256(); }
+    static v and_(const v a, const v b) { return _mm256_and_si256(a, b); }
+    static v or_(const v a, const v b) { return _mm256_or_si256(a, b); }
+    static v andnot(const v a, const v b) { return _mm256_andnot_si256(a, b); }
+    static v add(const v a, const v b) { return _mm256_add_epi16(a, b); }
+    static v sub(const v a, const v b) { return _mm256_sub_epi16(a, b); }
+    static v subs_u(const v a, const v b) { return _mm256_subs_epu16(a, b); }
+    static v max(const v a, const v b) { return _mm256_max_epi16(a, b); }
+    static v eq(const v a, const v b) { return _mm256_cmpeq_epi16(a, b); }
+    static v gt(const v a, const v b) { return _mm256_cmpgt_epi16(a, b); }
+    template<int S> static v sll(const v a) { return _mm256_slli_epi16(a, S); }
+    template<int S> static v srl(const v a) { return _mm256_srli_epi16(a, S); }
+    static v mulhi_u(const v a, const v b) { return _mm256_mulhi_epu16(a, b); }
+    static v mullo(const v a, const v b) { return _mm256_mullo_epi16(a, b); }
+    // Unpack and pack are both within 128-bit lanes, so the pairs keep the order
+    static v unpacklo(const v a, const v b) { return _mm256_unpacklo_epi16(a, b); }
+    static v unpackhi(const v a, const v b) { return _mm256_unpackhi_epi16(a, b); }
+    static v madd(const v a, const v b) { return _mm256_madd_epi16(a, b); }
+    static v add32(const v a, const v b) { return _mm256_add_epi32(a, b); }
+    static v sub32(const v a, const v b) { return _mm256_sub_epi32(a, b); }
+    static v gt32(const v a, const v b) { return _mm256_cmpgt_epi32(a, b); }
+    template<int S> static v srl32(const v a) { return _mm256_srli_epi32(a, S); }
+    template<int S> static v sra32(const v a) { return _mm256_srai_epi32(a, S); }
+    static v packs32(const v a, const v b) { return _mm256_packs_epi32(a, b); }
+    ///@endcond
+};
+#endif
+
+///@cond 0
+namespace detail
+{
+// Vector versions of q15::detail (I is the instruction set)
+template<typename I> struct curves
+{
+    using v = typename I::v;
+
+    static v select(const v m, const v a, const v b) { return I::or_(I::and_(m, a), I::andnot(m, b)); }
+    static v unit() { return I::set1(-32768); } // 32768 as unsigned
+    static v mul(const v a, const v b)
+    {
+        return I::add(I::template sll<1>(I::mulhi_u(a, b)), I::template srl<1>(I::add(I::template srl<14>(I::mullo(a, b)), I::set1(1))));
+    }
+    static v halve(const v x) { return I::template srl<1>(I::add(x, I::set1(1))); }
+    // 32-bit lanes [0, 65535] to 16-bit lanes
+    static v pack_u(const v lo, const v hi)
+    {
+        const v b = I::set1_32(32768);
+        return I::sub(I::packs32(I::sub32(lo, b), I::sub32(hi, b)), unit());
+    }
+    // (a * b + c * d + 2^14) >> 15 by pmaddwd (operands are less than 32768)
+    static v mul_add(const v a, const v b, const v c, const v d)
+    {
+        const v r = I::set1_32(0x4000);
+        return pack_u(I::template sra32<15>(I::add32(I::madd(I::unpacklo(a, c), I::unpacklo(b, d)), r)),
+                      I::template sra32<15>(I::add32(I::madd(I::unpackhi(a, c), I::unpackhi(b, d)), r)));
+    }
+    // Right shift by k (0 - 15) per lane
+    static v shift(v x, const v k)
+    {
+        x = select(I::eq(I::and_(k, I::set1(1)), I::set1(1)), I::template srl<1>(x), x);
+        x = select(I::eq(I::and_(k, I::set1(2)), I::set1(2)), I::template srl<2>(x), x);
+        x = select(I::eq(I::and_(k, I::set1(4)), I::set1(4)), I::template srl<4>(x), x);
+        return select(I::eq(I::and_(k, I::set1(8)), I::set1(8)), I::template srl<8>(x), x);
+    }
+    // Square root of 32-bit lanes in [0, 2^30]
+    static v sqrt30(v n)
+    {
+        v r = I::zero();
+        for(int bit = 30; bit >= 0; bit -= 2)
+        {
+            const v b = I::set1_32(1 << bit);
+            const v t = I::add32(r, b);
+            const v lt = I::gt32(t, n);
+            n = I::sub32(n, I::andnot(lt, t));
+            r = I::add32(I::template srl32<1>(r), I::andnot(lt, b));
+        }
+        return I::sub32(r, I::gt32(n, r));
+    }
+
+    static v sin_quarter(const v x, const v x2)
+    {
+        return I::add(x, mul(x, I::sub(I::set1(18704), mul(x2, I::sub(I::set1(21167), mul(x2, I::sub(I::set1(2611),
+                mul(x2, I::sub(I::set1(153), mul(x2, I::set1(5)))))))))));
+    }
+    static v versin_quarter(const v x, const v x2)
+    {
+        return mul_add(x, x, x2, I::sub(I::set1(7658), mul(x2, I::sub(I::set1(8312), mul(x2, I::sub(I::set1(684),
+                mul(x2, I::sub(I::set1(30), mul(x2, I::set1(1))))))))));
+    }
+    static v exp2_neg_frac(const v f)
+    {
+        return I::sub(unit(), mul(f, I::sub(I::set1(22713), mul(f, I::sub(I::set1(7872), mul(f, I::sub(I::set1(1819),
+                mul(f, I::sub(I::set1(315), mul(f, I::sub(I::set1(44), mul(f, I::set1(5)))))))))))));
+    }
+    // (v + 2^(s - 1)) >> s = ((v >> (s - 1)) + 1) >> 1 if s > 0
+    static v exp2_neg(const v f, const v s)
+    {
+        const v g = shift(exp2_neg_frac(f), I::subs_u(s, I::set1(1)));
+        return select(I::eq(s, I::zero()), g, halve(g));
+    }
+
+    // Ease in on x in [0, 32768]
+    static v inQuadratic(const v x) { return mul(x, x); }
+    static v inCubic(const v x) { return mul(mul(x, x), x); }
+    static v inQuartic(const v x) { return inQuadratic(mul(x, x)); }
+    static v inQuintic(const v x) { return mul(inQuartic(x), x); }
+    static v inSinusoidal(const v x) { return versin_quarter(x, mul(x, x)); }
+    // e = 10 * (32768 - x) is 20 bits, the high part of the product gives the integer part
+    static v inExponential(const v x)
+    {
+        const v d = I::sub(unit(), x);
+        const v lo = I::mullo(d, I::set1(10));
+        const v s = I::or_(I::template sll<1>(I::mulhi_u(d, I::set1(10))), I::template srl<15>(lo));
+        return I::andnot(I::eq(x, I::zero()), exp2_neg(I::and_(lo, I::set1(0x7FFF)), s));
+    }
+    static v inCircular(const v x)
+    {
+        const v lo = I::mullo(x, x);
+        const v hi = I::mulhi_u(x, x);
+        const v one30 = I::set1_32(1 << 30);
+        const v b = I::set1_32(32768);
+        return pack_u(I::sub32(b, sqrt30(I::sub32(one30, I::unpacklo(lo, hi)))), I::sub32(b, sqrt30(I::sub32(one30, I::unpackhi(lo, hi)))));
+    }
+
+    template<v (*In)(const v)> static v out(const v x) { return I::andnot(I::eq(x, I::zero()), I::sub(unit(), In(I::sub(unit(), x)))); }
+    // The upper half is 1/2 + (1 - In(2 - 2x)) / 2, and 1/2 at x = 1/2
+    template<v (*In)(const v)> static v in_out(const v x)
+    {
+        const v lower = I::gt(I::set1(q15::half), x);
+        const v x2 = I::add(x, x);
+        const v y = In(select(lower, x2, I::sub(I::zero(), x2)));
+        const v upper = select(I::eq(x, I::set1(q15::half)), I::set1(q15::half), I::add(I::set1(q15::half), halve(I::sub(unit(), y))));
+        return select(lower, halve(y), upper);
+    }
+    // Phase to [0, 32767], and the unsigned result to [0, 32767]
+    static v clamp_in(const v t) { return I::max(t, I::zero()); }
+    static v clamp_out(const v x) { return I::sub(x, I::subs_u(x, I::set1(q15::one))); }
+    template<v (*F)(const v)> static v apply(const v t) { return clamp_out(F(clamp_in(t))); }
+    static v outSinusoidal(const v t)
+    {
+        const v x = clamp_in(t);
+        return clamp_out(sin_quarter(x, mul(x, x)));
+    }
+};
+
+template<q15_t (*F)(const q15_t)> struct kernel; // Vector kernel of F
+#define GOBLIB_EASING_SIMD_KERNEL(name, expr)                                       \
+    template<> struct kernel<q15::name>                                             \
+    {                                                                               \
+        template<typename I> static typename I::v eval(const typename I::v t)       \
+        {                                                                           \
+            using K = curves<I>;                                                    \
+            return expr;                                                            \
+        }                                                                           \
+    };
+#define GOBLIB_EASING_SIMD_KERNELS(name)                                                              \
+    GOBLIB_EASING_SIMD_KERNEL(in##name, K::template apply<K::in##name>(t))                          \
+    GOBLIB_EASING_SIMD_KERNEL(out##name, K::template apply<K::template out<K::in##name>>(t))        \
+    GOBLIB_EASING_SIMD_KERNEL(inOut##name, K::template apply<K::template in_out<K::in##name>>(t))
+
+GOBLIB_EASING_SIMD_KERNEL(linear, K::clamp_in(t))
+GOBLIB_EASING_SIMD_KERNEL(inSinusoidal, K::template apply<K::inSinusoidal>(t))
+GOBLIB_EASING_SIMD_KERNEL(outSinusoidal, K::outSinusoidal(t))
+GOBLIB_EASING_SIMD_KERNEL(inOutSinusoidal, K::template apply<K::template in_out<K::inSinusoidal>>(t))
+GOBLIB_EASING_SIMD_KERNELS(Quadratic)
+GOBLIB_EASING_SIMD_KERNELS(Cubic)
+GOBLIB_EASING_SIMD_KERNELS(Quartic)
+GOBLIB_EASING_SIMD_KERNELS(Quintic)
+GOBLIB_EASING_SIMD_KERNELS(Exponential)
+GOBLIB_EASING_SIMD_KERNELS(Circular)
+#undef GOBLIB_EASING_SIMD_KERNELS
+#undef GOBLIB_EASING_SIMD_KERNEL
+//
+}
+///@endcond
+
+/// @brief No SIMD (scalar functions)
+struct scalar
+{
+    static constexpr std::size_t lanes = 1; //!< Number of Q1.15 lanes
+};
+
+#if defined(GOBLIB_EASING_SIMD_AVX2)
+using native = avx2; //!< Widest instruction set enabled
+#elif defined(GOBLIB_EASING_SIMD_SSE2)
+using native = sse2; //!< Widest instruction set enabled
+#else
+using native = scalar; //!< Widest instruction set enabled
+#endif
+
+///@cond 0
+namespace detail
+{
+template<q15_t (*F)(const q15_t), typename I> struct batch
+{
+    static void transform(const q15_t* in, q15_t* out, const std::size_t n)
+    {
+        constexpr std::size_t step = I::lanes * 2;
+        std::size_t i{};
+        for(; i + step <= n; i += step)
+        {
+            const typename I::v a = I::load(in + i);
+            const typename I::v b = I::load(in + i + I::lanes);
+            I::store(out + i, kernel<F>::template eval<I>(a));
+            I::store(out + i + I::lanes, kernel<F>::template eval<I>(b));
+        }
+        q15::transform<F>(in + i, out + i, n - i);
+    }
+};
+template<q15_t (*F)(const q15_t)> struct batch<F, scalar>
+{
+    static void transform(const q15_t* in, q15_t* out, const std::size_t n) { q15::transform<F>(in, out, n); }
+};
+//
+}
+///@endcond
+
+/*!
+  @brief Apply the curve to each phase
+  @tparam F Curve (e.g. q15::inCubic)
+  @tparam I Instruction set (simd::sse2, simd::avx2 or simd::scalar)
+  @param in Phases
+  @param out Results (may be the same as in)
+  @param n Number of samples
+  @note Same results as q15::transform
+ */
+template<q15_t (*F)(const q15_t), typename I = native> inline void transform(const q15_t* in, q15_t* out, const std::size_t n)
+{
+    detail::batch<F, I>::transform(in, out, n);
+}
+//
+}
+}}}}
+#endif
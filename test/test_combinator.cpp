@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <gob_easing_combinator.hpp>
+#include <type_traits>
+
+using namespace goblib;
+namespace fn = goblib::easing::fn;
+
+namespace
+{
+using drop = fn::chain<fn::inBack, fn::outBounce, std::ratio<1, 3>>;
+using mixed = fn::blend<fn::scale<fn::mirror<fn::inElastic>, std::ratio<2>>, fn::reverse<fn::outCubic>, std::ratio<1, 4>>;
+
+constexpr float (*table[])(const float) = { fn::call<fn::inBack, float>, fn::call<drop, float>, fn::call<mixed, float> };
+//
+}
+
+TEST(combinator, constexpr)
+{
+    // C++11 constexpr
+    static_assert(fn::inCubic{}(0.5f) == 0.125f, "oops!");
+    static_assert(fn::reverse<fn::inCubic>{}(0.5) == 0.125, "oops!");
+    static_assert(fn::mirror<fn::inCubic>{}(0.5) == 0.875, "oops!");
+    static_assert(fn::scale<fn::linear, std::ratio<2>>{}(0.75) == 1.0, "oops!");
+    static_assert(fn::blend<fn::linear, fn::inQuadratic>{}(0.5) == 0.375, "oops!");
+    static_assert(drop{}(0.0f) == 0.0f && drop{}(1.0f) == 1.0f, "oops!");
+    static_assert(fn::call<drop, double>(1.0 / 3.0) == 1.0 / 3.0, "oops!");
+    static_assert(std::is_empty<mixed>::value, "oops!");
+
+    EXPECT_EQ(easing::inBack(0.3f), table[0](0.3f));
+}
+
+TEST(combinator, equivalence)
+{
+    for(int i = 0; i <= 128; ++i)
+    {
+        const double t = static_cast<double>(i) / 128.0;
+        // Mirror of in is out
+        EXPECT_NEAR(easing::outBack(t), fn::mirror<fn::inBack>{}(t), 1e-15) << t;
+        EXPECT_NEAR(easing::outCubic(t), fn::mirror<fn::inCubic>{}(t), 1e-15) << t;
+        // inOutOf in and out is inOut
+        EXPECT_NEAR(easing::inOutCubic(t), (fn::inOutOf<fn::inCubic, fn::outCubic>{}(t)), 1e-15) << t;
+        EXPECT_NEAR(easing::inOutQuintic(t), (fn::inOutOf<fn::inQuintic, fn::outQuintic>{}(t)), 1e-15) << t;
+        EXPECT_NEAR(easing::inOutBounce(t), (fn::inOutOf<fn::inBounce, fn::outBounce>{}(t)), 1e-15) << t;
+        // Reverse twice is itself
+        EXPECT_EQ(easing::outElastic(t), fn::reverse<fn::reverse<fn::outElastic>>{}(t)) << t;
+        // Scale 1 is itself
+        EXPECT_EQ(easing::inSinusoidal(t), (fn::scale<fn::inSinusoidal, std::ratio<1>>{}(t))) << t;
+        // Scale 1/2 is the first half
+        EXPECT_EQ(easing::inQuadratic(t * 0.5), (fn::scale<fn::inQuadratic, std::ratio<1, 2>>{}(t))) << t;
+        // Blend
+        EXPECT_NEAR(0.75 * easing::inQuartic(t) + 0.25 * easing::outQuartic(t),
+                    (fn::blend<fn::inQuartic, fn::outQuartic, std::ratio<1, 4>>{}(t)), 1e-15) << t;
+        // Chain
+        const double c = t < 1.0 / 3.0 ? easing::inBack(t * 3.0) / 3.0 : 1.0 / 3.0 + easing::outBounce((t - 1.0 / 3.0) * 1.5) * (2.0 / 3.0);
+        EXPECT_NEAR(c, drop{}(t), 1e-15) << t;
+    }
+    // Policy
+    EXPECT_EQ((easing::inElastic<float, easing::precision::fast>(0.7f)),
+              (fn::curve<easing::Curve::inElastic, easing::precision::fast>{}(0.7f)));
+    // Nested
+    EXPECT_FLOAT_EQ(0.75f, table[2](1.0f)); // 3/4 * 1 (scale holds) + 1/4 * outCubic(0)
+    EXPECT_FLOAT_EQ(0.75f * (1.0f - easing::inElastic(0.6f)) + 0.25f * easing::outCubic(0.8f), table[2](0.2f));
+}
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <gob_easing_curve.hpp>
+#include <cctype>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+using namespace goblib;
+using easing::Curve;
+
+namespace
+{
+using ease_function = float(*)(const float);
+const ease_function functions[] =
+{
+    easing::linear<float>,
+    easing::inSinusoidal<float>, easing::outSinusoidal<float>, easing::inOutSinusoidal<float>,
+    easing::inQuadratic<float>, easing::outQuadratic<float>, easing::inOutQuadratic<float>,
+    easing::inCubic<float>, easing::outCubic<float>, easing::inOutCubic<float>,
+    easing::inQuartic<float>, easing::outQuartic<float>, easing::inOutQuartic<float>,
+    easing::inQuintic<float>, easing::outQuintic<float>, easing::inOutQuintic<float>,
+    easing::inExponential<float>, easing::outExponential<float>, easing::inOutExponential<float>,
+    easing::inCircular<float>, easing::outCircular<float>, easing::inOutCircular<float>,
+    easing::inBack<float>, easing::outBack<float>, easing::inOutBack<float>,
+    easing::inElastic<float>, easing::outElastic<float>, easing::inOutElastic<float>,
+    easing::inBounce<float>, easing::outBounce<float>, easing::inOutBounce<float>,
+};
+constexpr bool equal(const char* a, const char* b) { return *a == *b && (*a == '\0' || equal(a + 1, b + 1)); }
+//
+}
+
+TEST(curve, name)
+{
+    static_assert(easing::num_curves == 31, "oops!");
+    static_assert(sizeof(Curve) == 1, "oops!");
+    static_assert(equal(easing::name(Curve::linear), "linear"), "oops!");
+    static_assert(equal(easing::name(Curve::inOutBack), "inOutBack"), "oops!");
+    static_assert(equal(easing::name(Curve::inOutBounce), "inOutBounce"), "oops!");
+    static_assert(easing::name(static_cast<Curve>(easing::num_curves)) == nullptr, "oops!");
+
+    for(std::size_t i = 0; i < easing::num_curves; ++i)
+    {
+        EXPECT_NE(nullptr, easing::name(static_cast<Curve>(i))) << i;
+    }
+}
+
+TEST(curve, evaluate)
+{
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    static_assert(easing::evaluate(Curve::inCubic, 0.5f) == 0.125f, "oops!");
+    static_assert(easing::evaluate(Curve::outBounce, 1.0) == 1.0, "oops!");
+#endif
+    ASSERT_EQ(easing::num_curves, sizeof(functions) / sizeof(functions[0]));
+    for(std::size_t i = 0; i < easing::num_curves; ++i)
+    {
+        for(int j = 0; j <= 64; ++j)
+        {
+            const float t = static_cast<float>(j) / 64.0f;
+            EXPECT_EQ(functions[i](t), easing::evaluate(static_cast<Curve>(i), t)) << easing::name(static_cast<Curve>(i)) << " t:" << t;
+        }
+    }
+    // Out of range is linear
+    EXPECT_EQ(0.25f, easing::evaluate(static_cast<Curve>(200), 0.25f));
+}
+
+TEST(curve, ease)
+{
+    using easing::Ease;
+    static_assert(std::is_trivially_copyable<Ease<float>>::value, "oops!");
+    static_assert(std::is_trivially_copyable<Ease<double>>::value, "oops!");
+    static_assert(sizeof(Ease<float>) <= 16, "oops!");
+    static_assert(sizeof(Ease<double>) <= 16, "oops!");
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+    static_assert(Ease<float>{Curve::inCubic}(0.5f) == 0.125f, "oops!");
+    static_assert(Ease<double>{Curve::inBack, 0.0}(0.5) == 0.125, "oops!"); // Overshoot 0 is cubic
+#endif
+
+    // Default overshoot is the same as the curve
+    for(std::size_t i = 0; i < easing::num_curves; ++i)
+    {
+        const Ease<float> e{static_cast<Curve>(i)};
+        for(int j = 0; j <= 64; ++j)
+        {
+            const float t = static_cast<float>(j) / 64.0f;
+            EXPECT_EQ(functions[i](t), e(t)) << easing::name(e.curve) << " t:" << t;
+        }
+    }
+
+    // Overshoot
+    const Ease<double> in{Curve::inBack, 0.0}, out{Curve::outBack, 0.0}, inout{Curve::inOutBack, 0.0};
+    const Ease<double> strong{Curve::inBack, 3.0};
+    for(int j = 0; j <= 64; ++j)
+    {
+        const double t = static_cast<double>(j) / 64.0;
+        EXPECT_DOUBLE_EQ(easing::inCubic(t), in(t)) << t;
+        EXPECT_DOUBLE_EQ(easing::outCubic(t), out(t)) << t;
+        EXPECT_DOUBLE_EQ(easing::inOutCubic(t), inout(t)) << t;
+        EXPECT_DOUBLE_EQ(t * t * (4.0 * t - 3.0), strong(t)) << t;
+    }
+    EXPECT_LT(strong(0.4), easing::inBack(0.4)); // Deeper
+
+    // Copy as bytes
+    Ease<float> a[2] = { Ease<float>{Curve::outElastic}, Ease<float>{Curve::outBack, 2.5f} };
+    Ease<float> b[2];
+    std::memcpy(b, a, sizeof(a));
+    EXPECT_EQ(a[0](0.3f), b[0](0.3f));
+    EXPECT_EQ(a[1](0.3f), b[1](0.3f));
+    EXPECT_EQ(0.5f, Ease<float>{}(0.5f)); // linear
+}
+
+TEST(curve, find)
+{
+    static_assert(easing::find_curve("inOutBack").curve == Curve::inOutBack, "oops!");
+    static_assert(easing::find_curve("easeOutElastic").curve == Curve::outElastic, "oops!");
+    static_assert(easing::find_curve("easeInOutSine").curve == Curve::inOutSinusoidal, "oops!");
+    static_assert(!easing::find_curve("inOutBak"), "oops!");
+    static_assert(easing::function<float>(Curve::inBack) == &easing::inBack<float>, "oops!");
+
+    // All names, with ease and capitalized
+    for(std::size_t i = 0; i < easing::num_curves; ++i)
+    {
+        const Curve c = static_cast<Curve>(i);
+        const std::string n = easing::name(c);
+        std::string e = "ease" + n;
+        e[4] = static_cast<char>(std::toupper(e[4]));
+        for(auto& s : { n, e })
+        {
+            auto r = easing::find_curve(s.c_str());
+            EXPECT_TRUE(r.found) << s;
+            EXPECT_EQ(c, r.curve) << s;
+            // Not null-terminated
+            const std::string padded = s + "Xyz";
+            r = easing::find_curve(padded.c_str(), s.size());
+            EXPECT_TRUE(r.found) << s;
+            EXPECT_EQ(c, r.curve) << s;
+            EXPECT_FALSE(easing::find_curve(padded.c_str())) << padded;
+            EXPECT_FALSE(easing::find_curve(s.c_str(), s.size() - 1)) << s;
+        }
+        EXPECT_EQ(functions[i], easing::function<float>(c)) << n;
+    }
+    // easings.net
+    const char* net[] = { "Sine", "Quad", "Cubic", "Quart", "Quint", "Expo", "Circ", "Back", "Elastic", "Bounce" };
+    const char* dir[] = { "In", "Out", "InOut" };
+    for(std::size_t i = 0; i < 10; ++i)
+    {
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            const std::string s = std::string("ease") + dir[d] + net[i];
+            auto r = easing::find_curve(s.c_str());
+            EXPECT_TRUE(r.found) << s;
+            EXPECT_EQ(static_cast<Curve>(1 + i * 3 + d), r.curve) << s;
+        }
+    }
+    // Unknown
+    const char* unknown[] = { "", "ease", "Linear", "inoutback", "easeInOutBackX", "easeInOutExponentialXX", "inBounce ", "outSine" };
+    for(auto s : unknown) { EXPECT_FALSE(easing::find_curve(s)) << s; }
+    EXPECT_FALSE(easing::find_curve(nullptr));
+    EXPECT_EQ(nullptr, easing::function<float>(static_cast<Curve>(easing::num_curves)));
+}
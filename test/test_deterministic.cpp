@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <gob_easing.hpp>
+#include <gob_easing_deterministic.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+using namespace goblib;
+namespace d = goblib::easing::deterministic;
+namespace fx = goblib::easing::fx;
+
+namespace
+{
+// FNV-1a of the object representation
+template<typename U> std::uint32_t fnv1a(std::uint32_t h, const U& v)
+{
+    unsigned char b[sizeof(U)];
+    std::memcpy(b, &v, sizeof(U));
+    for(auto c : b) { h = (h ^ c) * 16777619U; }
+    return h;
+}
+template<typename U> std::uint64_t bits(const U v)
+{
+    std::uint64_t b{};
+    std::memcpy(&b, &v, sizeof(U));
+    return b;
+}
+
+// Golden values (must not change on any platform or build option)
+// Bits of f(0.3), FNV-1a of f(i / 4096) for i in [0, 4096] (float, double), FNV-1a of fx::f(t) for all t in [0, 1] (Q16.16)
+struct Golden
+{
+    const char* name;
+    float (*f)(const float);
+    double (*d)(const double);
+    fx::q16_t (*q)(const fx::q16_t);
+    double (*reference)(const double);
+    std::uint32_t float_bits;
+    std::uint64_t double_bits;
+    std::uint32_t float_hash;
+    std::uint32_t double_hash;
+    std::uint32_t q16_hash;
+};
+const Golden golden[] =
+{
+    { "linear", d::linear<float>, d::linear<double>, fx::linear, easing::linear<double>, 0x3E99999AU, 0x3FD3333333000000ULL, 0xD18E6C33U, 0x6639635DU, 0x43935AACU },
+    { "inSinusoidal", d::inSinusoidal<float>, d::inSinusoidal<double>, fx::inSinusoidal, easing::inSinusoidal<double>, 0x3DDF37FAU, 0x3FBBE6FF10000000ULL, 0x1CA3AC3EU, 0x1345492BU, 0x68D7C08BU },
+    { "outSinusoidal", d::outSinusoidal<float>, d::outSinusoidal<double>, fx::outSinusoidal, easing::outSinusoidal<double>, 0x3EE87172U, 0x3FDD0E2E2B000000ULL, 0x09CA4F5EU, 0xAF7E179FU, 0x4CC9D9C8U },
+    { "inOutSinusoidal", d::inOutSinusoidal<float>, d::inOutSinusoidal<double>, fx::inOutSinusoidal, easing::inOutSinusoidal<double>, 0x3E530DD1U, 0x3FCA61B9F8000000ULL, 0x5163B1ADU, 0xDFCA4DBAU, 0xE96EF255U },
+    { "inQuadratic", d::inQuadratic<float>, d::inQuadratic<double>, fx::inQuadratic, easing::inQuadratic<double>, 0x3DB851ECU, 0x3FB70A3D70000000ULL, 0x919C1EF3U, 0x9F54D4F0U, 0x22505EADU },
+    { "outQuadratic", d::outQuadratic<float>, d::outQuadratic<double>, fx::outQuadratic, easing::outQuadratic<double>, 0x3F028F5CU, 0x3FE051EB85000000ULL, 0xC14C1305U, 0xDCC36D4EU, 0xFD4C2A7AU },
+    { "inOutQuadratic", d::inOutQuadratic<float>, d::inOutQuadratic<double>, fx::inOutQuadratic, easing::inOutQuadratic<double>, 0x3E3851ECU, 0x3FC70A3D70000000ULL, 0x1131B8B9U, 0x82338233U, 0x191A8FB7U },
+    { "inCubic", d::inCubic<float>, d::inCubic<double>, fx::inCubic, easing::inCubic<double>, 0x3CDD2F1CU, 0x3F9BA5E350000000ULL, 0x41EF975FU, 0xDB8A591CU, 0xA2AE9262U },
+    { "outCubic", d::outCubic<float>, d::outCubic<double>, fx::outCubic, easing::outCubic<double>, 0x3F283127U, 0x3FE50624DD000000ULL, 0xC167D80BU, 0x3E223B22U, 0x75A3C376U },
+    { "inOutCubic", d::inOutCubic<float>, d::inOutCubic<double>, fx::inOutCubic, easing::inOutCubic<double>, 0x3DDD2F1CU, 0x3FBBA5E354000000ULL, 0x7F188E32U, 0x4A38CB0EU, 0xCDF8B96DU },
+    { "inQuartic", d::inQuartic<float>, d::inQuartic<double>, fx::inQuartic, easing::inQuartic<double>, 0x3C04B5DEU, 0x3F8096BBA0000000ULL, 0x3B26B637U, 0xBE36999FU, 0x28BE52C2U },
+    { "outQuartic", d::outQuartic<float>, d::outQuartic<double>, fx::outQuartic, easing::outQuartic<double>, 0x3F4288CFU, 0x3FE85119CE000000ULL, 0xBE0A75E1U, 0xD279D193U, 0x40C2FA36U },
+    { "inOutQuartic", d::inOutQuartic<float>, d::inOutQuartic<double>, fx::inOutQuartic, easing::inOutQuartic<double>, 0x3D84B5DEU, 0x3FB096BB98000000ULL, 0xF806BC36U, 0xF1D72C83U, 0x2BDA5E77U },
+    { "inQuintic", d::inQuintic<float>, d::inQuintic<double>, fx::inQuintic, easing::inQuintic<double>, 0x3B1F40A4U, 0x3F63E81480000000ULL, 0x11737C99U, 0x84461138U, 0x57AC8271U },
+    { "outQuintic", d::outQuintic<float>, d::outQuintic<double>, fx::outQuintic, easing::outQuintic<double>, 0x3F54F95EU, 0x3FEA9F2BAA000000ULL, 0x57688A40U, 0xC8B4B4EAU, 0xAE4956B5U },
+    { "inOutQuintic", d::inOutQuintic<float>, d::inOutQuintic<double>, fx::inOutQuintic, easing::inOutQuintic<double>, 0x3D1F40A5U, 0x3FA3E81450000000ULL, 0xE79E504BU, 0xBB29D348U, 0x3069EB97U },
+    { "inExponential", d::inExponential<float>, d::inExponential<double>, fx::inExponential, easing::inExponential<double>, 0x3C000001U, 0x3F80000000000000ULL, 0x7AB29A30U, 0xA00A5D41U, 0x9EE09C13U },
+    { "outExponential", d::outExponential<float>, d::outExponential<double>, fx::outExponential, easing::outExponential<double>, 0x3F600000U, 0x3FEC000000000000ULL, 0x9333CAD6U, 0x94EF697BU, 0x36C3E3C4U },
+    { "inOutExponential", d::inOutExponential<float>, d::inOutExponential<double>, fx::inOutExponential, easing::inOutExponential<double>, 0x3D000002U, 0x3FA0000000000000ULL, 0x62CF788BU, 0x0CF765BAU, 0xD10F268CU },
+    { "inCircular", d::inCircular<float>, d::inCircular<double>, fx::inCircular, easing::inCircular<double>, 0x3D3CAA40U, 0x3FA79547F0000000ULL, 0x89447426U, 0x160690FEU, 0x48454C01U },
+    { "outCircular", d::outCircular<float>, d::outCircular<double>, fx::outCircular, easing::outCircular<double>, 0x3F36D211U, 0x3FE6DA4217000000ULL, 0x75FD44D9U, 0x70AFFB54U, 0xCD3ACD6AU },
+    { "inOutCircular", d::inOutCircular<float>, d::inOutCircular<double>, fx::inOutCircular, easing::inOutCircular<double>, 0x3DCCCCCEU, 0x3FB999999C000000ULL, 0xDAF63DC1U, 0x636AB941U, 0x92E7ECFFU },
+    { "inBack", d::inBack<float>, d::inBack<double>, fx::inBack, easing::inBack<double>, 0xBDA43FA8U, 0xBFB487F500000000ULL, 0x4C7C5688U, 0xB49D2B9DU, 0xF2499991U },
+    { "outBack", d::outBack<float>, d::outBack<double>, fx::outBack, easing::outBack<double>, 0x3F6839D2U, 0x3FED073A3B800000ULL, 0x09D46D4BU, 0x297BD5EAU, 0x678FA7D2U },
+    { "inOutBack", d::inOutBack<float>, d::inOutBack<double>, fx::inOutBack, easing::inOutBack<double>, 0xBDA17372U, 0xBFB42E6E64000000ULL, 0xC232857DU, 0x758186BCU, 0xE074C9B1U },
+    { "inElastic", d::inElastic<float>, d::inElastic<double>, fx::inElastic, easing::inElastic<double>, 0xBB7FFFFCU, 0xBF70000000000000ULL, 0xD6BE2834U, 0x6CB47A59U, 0x6220A561U },
+    { "outElastic", d::outElastic<float>, d::outElastic<double>, fx::outElastic, easing::outElastic<double>, 0x3F600000U, 0x3FEC000000000000ULL, 0xCF1D6C45U, 0x246C9356U, 0x50498383U },
+    { "inOutElastic", d::inOutElastic<float>, d::inOutElastic<double>, fx::inOutElastic, easing::inOutElastic<double>, 0x3CC41B7CU, 0x3F98836FA0000000ULL, 0xD93EB087U, 0x040C292DU, 0x48E22FFCU },
+    { "inBounce", d::inBounce<float>, d::inBounce<double>, fx::inBounce, easing::inBounce<double>, 0x3D8E147FU, 0x3FB1C28F58000000ULL, 0xFC511905U, 0xF16F7358U, 0x14B4E4FCU },
+    { "outBounce", d::outBounce<float>, d::outBounce<double>, fx::outBounce, easing::outBounce<double>, 0x3F2E3D72U, 0x3FE5C7AE14000000ULL, 0xD197A086U, 0x35BE7A53U, 0xCA4DE5E1U },
+    { "inOutBounce", d::inOutBounce<float>, d::inOutBounce<double>, fx::inOutBounce, easing::inOutBounce<double>, 0x3D3851E4U, 0x3FA70A3D78000000ULL, 0x9D6676DAU, 0xD8223F00U, 0x55A70DA1U },
+};
+//
+}
+
+TEST(deterministic, constexpr)
+{
+    static_assert(d::inOutBounce(1.0f) == 1.0f && d::inOutBounce(0.0) == 0.0, "oops!");
+    static_assert(d::linear(0.3f) == 0.3f, "oops!");
+    constexpr float v = d::inOutElastic(0.3f);
+    EXPECT_EQ(golden[27].float_bits, bits(v));
+    constexpr double w = d::outSinusoidal(0.3);
+    EXPECT_EQ(golden[2].double_bits, bits(w));
+}
+
+TEST(deterministic, argument)
+{
+    EXPECT_EQ(0.0f, d::inCubic(-1.0f));
+    EXPECT_EQ(1.0f, d::inCubic(2.0f));
+#if !defined(__FAST_MATH__)
+    EXPECT_EQ(0.0f, d::outBack(std::numeric_limits<float>::quiet_NaN()));
+#endif
+    EXPECT_EQ(1.0, d::inOutSinusoidal(std::numeric_limits<double>::infinity()));
+    // Step at 0 (found by bench/exhaustive)
+    EXPECT_EQ(0.0f, d::inExponential(0.0f));
+    EXPECT_NEAR(easing::inExponential(1e-12), d::inExponential(1e-12), 1e-8);
+    EXPECT_NEAR(easing::inElastic(1e-40f), d::inElastic(1e-40f), 1e-8f);
+    // Step at 1
+    EXPECT_EQ(1.0, d::outExponential(1.0));
+    EXPECT_NEAR(easing::outExponential(1.0 - 1e-12), d::outExponential(1.0 - 1e-12), 1e-8);
+    EXPECT_NEAR(easing::outElastic(1.0 - 1e-12), d::outElastic(1.0 - 1e-12), 1e-8);
+    EXPECT_NEAR(easing::inOutExponential(1.0 - 1e-12), d::inOutExponential(1.0 - 1e-12), 1e-8);
+    // Infinite slope at the ends of Circular
+    EXPECT_NEAR(1.4142135623e-6, d::outCircular(1e-12), 1e-9);
+    EXPECT_NEAR(1.0 - 1.4142135623e-6, d::inCircular(1.0 - 1e-12), 1e-9);
+    EXPECT_NEAR(1.4142135e-6f, d::outCircular(1e-12f), 1e-9f);
+}
+
+TEST(deterministic, golden)
+{
+    for(auto& g : golden)
+    {
+        std::uint32_t hf = 2166136261U, hd = 2166136261U, hq = 2166136261U;
+        for(int i = 0; i <= 4096; ++i)
+        {
+            hf = fnv1a(hf, g.f(static_cast<float>(i) / 4096.0f));
+            hd = fnv1a(hd, g.d(static_cast<double>(i) / 4096.0));
+        }
+        for(fx::q16_t t = 0; t <= fx::one; ++t) { hq = fnv1a(hq, g.q(t)); }
+
+        EXPECT_EQ(g.float_bits, bits(g.f(0.3f))) << g.name;
+        EXPECT_EQ(g.double_bits, bits(g.d(0.3))) << g.name;
+        EXPECT_EQ(g.float_hash, hf) << g.name;
+        EXPECT_EQ(g.double_hash, hd) << g.name;
+        EXPECT_EQ(g.q16_hash, hq) << g.name;
+    }
+}
+
+// Accuracy against the double template
+TEST(deterministic, precision)
+{
+    for(auto& g : golden)
+    {
+        double err{};
+        for(int i = 0; i <= 4096; ++i)
+        {
+            const double t = static_cast<double>(i) / 4096.0;
+            err = std::fmax(err, std::fabs(g.d(t) - g.reference(t)));
+        }
+        // Off the grid, tiny and near the ends of the pieces (Circular has infinite slope at them)
+        for(double s : { 1e-300, 1e-40, 1e-12, 1e-10, 1.5e-9, 3e-9, 1e-7, 1e-5 })
+        {
+            for(double t : { s, 0.25 - s, 0.25 + s, 0.5 - s, 0.5 + s, 0.75 - s, 0.75 + s, 1.0 - s })
+            {
+                err = std::fmax(err, std::fabs(g.d(t) - g.reference(t)));
+            }
+        }
+        std::printf("%-18s %.2e\n", g.name, err);
+        EXPECT_LE(err, 7e-9) << g.name;
+    }
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <gob_easing.hpp>
+#if defined(GOBLIB_EASING_CONSTEXPR_CPP14)
+#include <gob_easing_double_double.hpp>
+#include <cmath>
+
+using namespace goblib;
+using easing::double_double;
+
+namespace
+{
+#if defined(GOBLIB_EASING_USING_OWN_MATH)
+constexpr double curve_tolerance = 1e-9; // Own math pow and sin are less accurate
+#else
+constexpr double curve_tolerance = 1e-14;
+#endif
+// |a - b| as double
+double diff(const double_double& a, const double_double& b)
+{
+    auto d = a - b;
+    return std::fabs(d.hi);
+}
+//
+}
+
+TEST(double_double, arithmetic)
+{
+    constexpr double_double third = double_double{1.0} / 3.0;
+    static_assert(third.lo != 0.0, "oops!");
+    EXPECT_LT(diff(third * 3.0, 1.0), 1e-31);
+
+    constexpr double_double s2 = easing::math::sqrt(double_double{2.0});
+    EXPECT_LT(diff(s2 * s2, 2.0), 1e-31);
+    EXPECT_EQ(std::sqrt(2.0), s2.hi);
+
+    // 0.1 + 0.2 - 0.3 is exact in double-double (of the double values)
+    double_double v = double_double{0.1} + 0.2;
+    EXPECT_EQ(0.1 + 0.2, v.hi);
+    EXPECT_NE(0.0, v.lo);
+
+    EXPECT_TRUE(double_double{1.0} < double_double(1.0, 1e-20));
+    EXPECT_TRUE(double_double(1.0, -1e-20) < 1.0);
+    EXPECT_TRUE(-double_double{1.0} <= -1.0);
+}
+
+TEST(double_double, math)
+{
+    // Reference values (31 digits)
+    constexpr double_double s1 = easing::math::sin(double_double{1.0});
+    constexpr double_double c1 = easing::math::cos(double_double{1.0});
+    EXPECT_LT(diff(s1, double_double{8.414709848078965e-01, 1.776845092935536e-18}), 1e-31);
+    EXPECT_LT(diff(c1, double_double{5.403023058681398e-01, -4.760954612604417e-17}), 1e-31);
+    EXPECT_LT(diff(s1 * s1 + c1 * c1, 1.0), 1e-31);
+
+    constexpr double_double e = easing::math::exp2(double_double{0.5});
+    EXPECT_LT(diff(e * e, 2.0), 1e-31);
+    EXPECT_EQ(1024.0, easing::math::exp2(double_double{10.0}).hi);
+
+    for(int i = -360; i <= 360; ++i)
+    {
+        double x = i * 0.0625;
+        EXPECT_NEAR(std::sin(x), (double)easing::math::sin(double_double{x}), 1e-16) << x;
+        EXPECT_NEAR(std::cos(x), (double)easing::math::cos(double_double{x}), 1e-16) << x;
+        EXPECT_NEAR(1.0, (double)easing::math::exp2(double_double{x * 0.1}) / std::exp2(x * 0.1), 1e-15) << x;
+    }
+}
+
+TEST(double_double, curves)
+{
+    using function_dd = double_double(*)(const double_double);
+    using function_d = double(*)(const double);
+    const function_dd table_dd[] =
+    {
+        easing::linear<double_double>,
+        easing::inSinusoidal<double_double>, easing::outSinusoidal<double_double>, easing::inOutSinusoidal<double_double>,
+        easing::inQuadratic<double_double>, easing::outQuadratic<double_double>, easing::inOutQuadratic<double_double>,
+        easing::inCubic<double_double>, easing::outCubic<double_double>, easing::inOutCubic<double_double>,
+        easing::inQuartic<double_double>, easing::outQuartic<double_double>, easing::inOutQuartic<double_double>,
+        easing::inQuintic<double_double>, easing::outQuintic<double_double>, easing::inOutQuintic<double_double>,
+        easing::inExponential<double_double>, easing::outExponential<double_double>, easing::inOutExponential<double_double>,
+        easing::inCircular<double_double>, easing::outCircular<double_double>, easing::inOutCircular<double_double>,
+        easing::inBack<double_double>, easing::outBack<double_double>, easing::inOutBack<double_double>,
+        easing::inElastic<double_double>, easing::outElastic<double_double>, easing::inOutElastic<double_double>,
+        easing::inBounce<double_double>, easing::outBounce<double_double>, easing::inOutBounce<double_double>,
+    };
+    const function_d table_d[] =
+    {
+        easing::linear<double>,
+        easing::inSinusoidal<double>, easing::outSinusoidal<double>, easing::inOutSinusoidal<double>,
+        easing::inQuadratic<double>, easing::outQuadratic<double>, easing::inOutQuadratic<double>,
+        easing::inCubic<double>, easing::outCubic<double>, easing::inOutCubic<double>,
+        easing::inQuartic<double>, easing::outQuartic<double>, easing::inOutQuartic<double>,
+        easing::inQuintic<double>, easing::outQuintic<double>, easing::inOutQuintic<double>,
+        easing::inExponential<double>, easing::outExponential<double>, easing::inOutExponential<double>,
+        easing::inCircular<double>, easing::outCircular<double>, easing::inOutCircular<double>,
+        easing::inBack<double>, easing::outBack<double>, easing::inOutBack<double>,
+        easing::inElastic<double>, easing::outElastic<double>, easing::inOutElastic<double>,
+        easing::inBounce<double>, easing::outBounce<double>, easing::inOutBounce<double>,
+    };
+    static_assert(sizeof(table_dd) / sizeof(table_dd[0]) == 31, "oops!");
+    static_assert(sizeof(table_d) / sizeof(table_d[0]) == 31, "oops!");
+
+    for(size_t idx = 0; idx < 31; ++idx)
+    {
+        EXPECT_LT(diff(table_dd[idx](0.0), 0.0), 1e-30) << idx;
+        EXPECT_LT(diff(table_dd[idx](1.0), 1.0), 1e-30) << idx;
+        for(int i = 0; i <= 256; ++i)
+        {
+            double t = i / 256.0;
+            EXPECT_NEAR(table_d[idx](t), (double)table_dd[idx](t), curve_tolerance) << idx << " | " << t;
+        }
+    }
+
+    // More accurate than double (exact values at t = double(0.3) computed offline in rational arithmetic)
+    const double_double ib{-0.08019954, 2.9541324941817493e-18};
+    const double_double ob{0.90713226, -4.122359564817657e-17};
+    const double_double iob{-0.07883348400000001, 6.84206691303758e-19};
+    EXPECT_LT(diff(easing::inBack<double_double>(0.3), ib), 1e-30);
+    EXPECT_LT(diff(easing::outBack<double_double>(0.3), ob), 1e-30);
+    EXPECT_LT(diff(easing::inOutBack<double_double>(0.3), iob), 1e-30);
+    EXPECT_GT(diff(easing::inBack<double>(0.3), ib), 1e-30); // double cannot hold it
+
+    // constexpr
+    constexpr double_double v = easing::inOutElastic<double_double>(0.3);
+    EXPECT_NEAR(easing::inOutElastic(0.3), v.hi, 1e-15);
+
+    // Compute float in double-double
+    using policy = easing::precision::compute_in<double_double, easing::precision::exact>;
+    constexpr float f = easing::inOutBack<float, policy>(0.3f);
+    EXPECT_EQ((float)(double)easing::inOutBack<double_double>(double_double{0.3f}), f);
+}
+#endif
@@ -3,6 +3,7 @@
 #include <gob_easing.hpp>
 #include <cmath>
 #include <limits>
+#include <algorithm>
 
 using namespace goblib;
 
@@ -45,6 +46,8 @@ template<typename T> void test_sqrt()
         EXPECT_TRUE(fp_eq(s, e)) << table[i] << answer[i];
     }
     // for negative (Notice: NAN == NAN make false)
+    // -ffast-math assumes no NaN, so the comparisons are meaningless
+#if !defined(__FAST_MATH__)
     {
         auto s = std::sqrt(-1.0f);
         auto e = easing::math::sqrt(-1.0f);
@@ -52,6 +55,7 @@ template<typename T> void test_sqrt()
         EXPECT_FALSE(e == e);
         EXPECT_FALSE(s == e);
     }
+#endif
 }
 //
 }
@@ -185,8 +189,75 @@ TEST(own_math, sincos)
         }
     }
 }
+
+// Iterations are capped, so they terminate even if the convergence test never holds
+TEST(own_math, termination)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    volatile double r{};
+    r = easing::math::exp(nan);
+    r = easing::math::sin(nan);
+    r = easing::math::cos(inf);
+    r = easing::math::sqrt(1e300);
+    r = easing::math::pow(nan, 0.5);
+    r = easing::math::sin(1e6);
+#if !defined(__FAST_MATH__)
+    EXPECT_TRUE(std::isnan(easing::math::exp(nan)));
+    EXPECT_TRUE(std::isnan(easing::math::sin(nan)));
+#endif
+    EXPECT_NEAR(1e150, easing::math::sqrt(1e300), 1e135);
+    (void)r;
+}
 #endif
 
+// Boundary guards are ordered comparisons, so they hold for any build flags and out of range input
+TEST(easing, guard)
+{
+    for(double t : { -1.0, -1e-300, 0.0 })
+    {
+        EXPECT_EQ(0.0, easing::inExponential(t)) << t;
+        EXPECT_EQ(0.0, easing::inOutExponential(t)) << t;
+        EXPECT_EQ(0.0, easing::inElastic(t)) << t;
+        EXPECT_EQ(0.0, easing::outElastic(t)) << t;
+        EXPECT_EQ(0.0, easing::inOutElastic(t)) << t;
+    }
+    for(double t : { 1.0, 1.0 + 1e-15, 2.0 })
+    {
+        EXPECT_EQ(1.0, easing::outExponential(t)) << t;
+        EXPECT_EQ(1.0, easing::inOutExponential(t)) << t;
+        EXPECT_EQ(1.0, easing::inElastic(t)) << t;
+        EXPECT_EQ(1.0, easing::outElastic(t)) << t;
+        EXPECT_EQ(1.0, easing::inOutElastic(t)) << t;
+    }
+}
+
+// -------------------------------------
+// sin_n/cos_n
+TEST(math, sincos_n)
+{
+    // constexpr
+    constexpr double cs = easing::math::sin_n<9>(1.0);
+    constexpr double cc = easing::math::cos_n<9>(1.0);
+    EXPECT_NEAR(std::sin(1.0), cs, 1e-15);
+    EXPECT_NEAR(std::cos(1.0), cc, 1e-15);
+
+    for(int i = -2000; i <= 2000; ++i)
+    {
+        double d = i * 0.0125;
+        EXPECT_NEAR(std::sin(d), easing::math::sin_n<1>(d), 0.3) << d;
+        EXPECT_NEAR(std::cos(d), easing::math::cos_n<1>(d), 0.3) << d;
+        EXPECT_NEAR(std::sin(d), easing::math::sin_n<4>(d), 4e-6) << d;
+        EXPECT_NEAR(std::cos(d), easing::math::cos_n<4>(d), 4e-6) << d;
+        EXPECT_NEAR(std::sin(d), easing::math::sin_n<9>(d), 1e-15) << d;
+        EXPECT_NEAR(std::cos(d), easing::math::cos_n<9>(d), 1e-15) << d;
+
+        float f = (float)d;
+        EXPECT_NEAR(std::sin(f), easing::math::sin_n<5>(f), 1e-6f) << f;
+        EXPECT_NEAR(std::cos(f), easing::math::cos_n<5>(f), 1e-6f) << f;
+    }
+}
+
 // -------------------------------------
 // easing
 namespace
@@ -394,7 +465,11 @@ TEST(easing, basic)
             auto v = func(0.0L);
             bool b = std::is_same<long double, decltype(v) >::value;
             EXPECT_TRUE(b) << name[idx];
-#if defined(GOBLIB_EASING_USING_OWN_MATH)
+#if defined(GOBLIB_EASING_LONG_DOUBLE_AS_DOUBLE)
+            // Computed in double
+            EXPECT_NEAR(0.0L, func(0.0L), DBL_EPSILON) << name[idx];
+            EXPECT_NEAR(1.0L, func(1.0L), DBL_EPSILON) << name[idx];
+#elif defined(GOBLIB_EASING_USING_OWN_MATH)
             EXPECT_DOUBLE_EQ(0.0L, func(0.0L)) << name[idx];
             EXPECT_DOUBLE_EQ(1.0L, func(1.0L)) << name[idx];
 #else
@@ -411,3 +486,45 @@ TEST(easing, basic)
         }
     }
 }
+
+TEST(easing, derived_constants)
+{
+    using KF = easing::constants::derived<float>;
+    using KD = easing::constants::derived<double>;
+    static_assert(KF::bounce_b1 == 1.0f / 2.75f && KF::bounce_o3 == 2.625f / 2.75f, "oops!");
+    static_assert(KD::bounce_b3 == 2.5 / 2.75 && KD::bounce_o2 == 2.25 / 2.75, "oops!");
+    static_assert(KD::back_c3 == 1.70158 + 1.0 && KD::back_c2 == 1.70158 * 1.525, "oops!");
+    static_assert(KF::elastic_c4 == easing::constants::pi2<float>() / 3.0f, "oops!");
+
+    // Breakpoints of Bounce are continuous
+    const double eps = 1e-12;
+    for(auto b : { KD::bounce_b1, KD::bounce_b2, KD::bounce_b3 })
+    {
+        EXPECT_NEAR(easing::outBounce(b - eps), easing::outBounce(b), 1e-10) << b;
+    }
+    // Takes const T& (ODR-use)
+    EXPECT_EQ(KD::bounce_n1, std::max(KD::bounce_n1, 0.0));
+}
+
+#if defined(__cpp_consteval)
+TEST(easing, consteval)
+{
+    constexpr float f = easing::ce::inOutBack(0.25f);
+    constexpr double d = easing::ce::outElastic(0.25);
+    EXPECT_FLOAT_EQ(easing::inOutBack(0.25f), f);
+    EXPECT_DOUBLE_EQ(easing::outElastic(0.25), d);
+
+    constexpr auto table = easing::ce::make_table<easing::inBounce<float>, 52>();
+    static_assert(table.size() == 52, "oops!");
+    static_assert(table.front() == 0.0f && table.back() == 1.0f, "oops!");
+    for(size_t i = 0; i < table.size(); ++i)
+    {
+#if defined(__FAST_MATH__)
+        // Runtime division may be reciprocal multiplication
+        EXPECT_NEAR(easing::inBounce((float)i / 51), table[i], 1e-5f) << i;
+#else
+        EXPECT_FLOAT_EQ(easing::inBounce((float)i / 51), table[i]) << i;
+#endif
+    }
+}
+#endif
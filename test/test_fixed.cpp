@@ -0,0 +1,387 @@
+#include <gtest/gtest.h>
+#include <gob_easing.hpp>
+#include <gob_easing_fixed.hpp>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+
+using namespace goblib;
+namespace fx = goblib::easing::fx;
+
+namespace
+{
+struct Curve
+{
+    const char* name;
+    fx::q16_t (*fixed)(const fx::q16_t);
+    double (*d)(const double);
+    float (*f)(const float);
+};
+#define GOB_FX_CURVE(name) { #name, fx::name, easing::name<double>, easing::name<float> }
+const Curve curves[] =
+{
+    GOB_FX_CURVE(linear),
+    GOB_FX_CURVE(inSinusoidal), GOB_FX_CURVE(outSinusoidal), GOB_FX_CURVE(inOutSinusoidal),
+    GOB_FX_CURVE(inQuadratic), GOB_FX_CURVE(outQuadratic), GOB_FX_CURVE(inOutQuadratic),
+    GOB_FX_CURVE(inCubic), GOB_FX_CURVE(outCubic), GOB_FX_CURVE(inOutCubic),
+    GOB_FX_CURVE(inQuartic), GOB_FX_CURVE(outQuartic), GOB_FX_CURVE(inOutQuartic),
+    GOB_FX_CURVE(inQuintic), GOB_FX_CURVE(outQuintic), GOB_FX_CURVE(inOutQuintic),
+    GOB_FX_CURVE(inExponential), GOB_FX_CURVE(outExponential), GOB_FX_CURVE(inOutExponential),
+    GOB_FX_CURVE(inCircular), GOB_FX_CURVE(outCircular), GOB_FX_CURVE(inOutCircular),
+    GOB_FX_CURVE(inBack), GOB_FX_CURVE(outBack), GOB_FX_CURVE(inOutBack),
+    GOB_FX_CURVE(inElastic), GOB_FX_CURVE(outElastic), GOB_FX_CURVE(inOutElastic),
+    GOB_FX_CURVE(inBounce), GOB_FX_CURVE(outBounce), GOB_FX_CURVE(inOutBounce),
+};
+#undef GOB_FX_CURVE
+//
+}
+
+TEST(fixed, basic)
+{
+    static_assert(fx::one == 65536, "oops!");
+    static_assert(fx::from_float(0.5f) == fx::half, "oops!");
+    static_assert(fx::from_float(-1.0) == -fx::one, "oops!");
+    static_assert(fx::to_float<double>(fx::half) == 0.5, "oops!");
+
+    // constexpr (C++11)
+    static_assert(fx::inOutBounce(fx::one) == fx::one, "oops!");
+    static_assert(fx::inOutElastic(fx::half) == fx::half, "oops!");
+    static_assert(fx::inOutSinusoidal(fx::half) == fx::half, "oops!");
+    constexpr fx::q16_t table[] = { fx::inCubic(fx::half), fx::outCircular(0), fx::inExponential(fx::one) };
+    static_assert(table[0] == fx::one / 8 && table[1] == 0 && table[2] == fx::one, "oops!");
+
+    // Both ends
+    for(auto& c : curves)
+    {
+        EXPECT_EQ(0, c.fixed(0)) << c.name;
+        EXPECT_EQ(fx::one, c.fixed(fx::one)) << c.name;
+    }
+    // Out of range argument
+    EXPECT_EQ(0, fx::inExponential(-fx::one));
+    EXPECT_EQ(fx::one, fx::outElastic(fx::one * 2));
+    EXPECT_EQ(fx::one, fx::inCircular(fx::one * 3));
+}
+
+// Compare all Q16.16 arguments in [0, 1] with double and float templates
+TEST(fixed, precision)
+{
+    std::printf("%-18s %10s %10s (LSB)\n", "Curve", "vs double", "vs float");
+    for(auto& c : curves)
+    {
+        double errd{}, errf{};
+        for(fx::q16_t t = 0; t <= fx::one; ++t)
+        {
+            const double v = fx::to_float<double>(c.fixed(t));
+            errd = std::fmax(errd, std::fabs(v - c.d(fx::to_float<double>(t))));
+            errf = std::fmax(errf, std::fabs(v - static_cast<double>(c.f(fx::to_float<float>(t)))));
+        }
+        errd *= fx::one;
+        errf *= fx::one;
+        std::printf("%-18s %10.2f %10.2f\n", c.name, errd, errf);
+        EXPECT_LE(errd, 0.51) << c.name;  // Rounding of the result only
+        EXPECT_LE(errf, 1.0) << c.name;
+    }
+}
+
+// Bounce and Back are the exact value rounded once
+TEST(fixed, exact)
+{
+    static_assert(fx::outBounce(fx::half) == 50176, "oops!"); // 0.765625
+    static_assert(fx::inBounce(fx::half) == 15360, "oops!");  // 0.234375
+
+    // (11n - 4a * 2^16)^2 + c * 2^36 is exact in double
+    auto bounce36 = [](const double n)
+    {
+        const double m = 11.0 * n;
+        return m < 4 * 65536.0 ? m * m :
+                m < 8 * 65536.0 ? (m - 6 * 65536.0) * (m - 6 * 65536.0) + 0.75 * 68719476736.0 :
+                m < 10 * 65536.0 ? (m - 9 * 65536.0) * (m - 9 * 65536.0) + 0.9375 * 68719476736.0 :
+                (m - 10.5 * 65536.0) * (m - 10.5 * 65536.0) + 0.984375 * 68719476736.0;
+    };
+    // Back with the constants k / 2^24
+    const long double k1 = fx::detail::back_k1 / 16777216.0L, k2 = fx::detail::back_k2 / 16777216.0L;
+    EXPECT_LE(std::fabs(static_cast<double>(k1) - easing::constants::derived<double>::back_c1), 1.2e-8);
+    EXPECT_LE(std::fabs(static_cast<double>(k2) - easing::constants::derived<double>::back_c2), 1.2e-8);
+    auto back = [](const long double t, const long double k) { return t * t * ((k + 1) * t - k); };
+
+    for(fx::q16_t t = 0; t <= fx::one; ++t)
+    {
+        const double n = t;
+        EXPECT_EQ(std::floor(bounce36(n) / 1048576.0 + 0.5), fx::outBounce(t)) << t;
+        EXPECT_EQ(std::floor((68719476736.0 - bounce36(65536.0 - n)) / 1048576.0 + 0.5), fx::inBounce(t)) << t;
+        EXPECT_EQ(std::floor((t < fx::half ? 68719476736.0 - bounce36(65536.0 - 2 * n) : 68719476736.0 + bounce36(2 * n - 65536.0))
+                             / 2097152.0 + 0.5), fx::inOutBounce(t)) << t;
+
+        const long double u = t / 65536.0L;
+        const long double ib = back(u, k1);
+        const long double ob = 1 - back(1 - u, k1);
+        const long double iob = u < 0.5L ? back(u * 2, k2) / 2 : 1 - back(2 - u * 2, k2) / 2;
+        EXPECT_LE(std::fabs(static_cast<double>(ib * 65536 - fx::inBack(t))), 0.5 + 1e-6) << t;
+        EXPECT_LE(std::fabs(static_cast<double>(ob * 65536 - fx::outBack(t))), 0.5 + 1e-6) << t;
+        EXPECT_LE(std::fabs(static_cast<double>(iob * 65536 - fx::inOutBack(t))), 0.5 + 1e-6) << t;
+    }
+}
+
+TEST(fixed, reciprocal)
+{
+    static_assert(fx::reciprocal{3}.ratio(1) == 21845, "oops!");
+    static_assert(fx::reciprocal{3}.ratio(2) == 43691, "oops!");
+    static_assert(fx::reciprocal{0}.ratio(0) == fx::one, "oops!");
+    static_assert(fx::detail::inverse(0x80000000U) == 0xFFFFFFFFU, "oops!");
+    std::mt19937 rng{20241017};
+
+    // Inverse without division
+    auto inverse = [](const std::uint32_t d)
+    {
+        EXPECT_EQ(0x7FFFFFFFFFFFFFFFULL / d, fx::detail::inverse(d)) << std::hex << d;
+    };
+    for(std::uint32_t i = 0; i < 65536; ++i)
+    {
+        inverse(0x80000000U + i);
+        inverse(0xFFFFFFFFU - i);
+    }
+    for(int i = 0; i < 100000; ++i) { inverse(static_cast<std::uint32_t>(rng()) | 0x80000000U); }
+
+    // Against division
+    const std::uint32_t divisors[] = { 1, 2, 3, 7, 1000, 1500, 65535, 65536, 65537, 0x7FFFFFFFU, 0x80000000U, 0x80000001U, 0xFFFFFFFFU };
+    auto check = [](const std::uint32_t d, const std::uint32_t n)
+    {
+        const fx::reciprocal r{d};
+        const std::uint64_t expected = n >= d ? 65536 : ((static_cast<std::uint64_t>(n) << 16) + d / 2) / d;
+        EXPECT_EQ(expected, static_cast<std::uint64_t>(r.ratio(n))) << d << '/' << n;
+        // By division (lerp from 0 to one is the ratio itself)
+        EXPECT_EQ(static_cast<std::int64_t>(expected), fx::ease_int<fx::linear>(n, d, 0, fx::one)) << d << '/' << n;
+    };
+    for(auto d : divisors)
+    {
+        for(std::uint32_t n : { 0U, 1U, d / 2, d / 2 + 1, d - 1, d, d + 1 }) { check(d, n); }
+        for(int i = 0; i < 10000; ++i) { check(d, rng() % d); }
+    }
+    for(int i = 0; i < 100000; ++i)
+    {
+        const std::uint32_t d = (rng() >> (rng() % 32)) | 1;
+        check(d, rng() % d);
+    }
+}
+
+TEST(fixed, ease_int)
+{
+    static_assert(fx::ease_int<fx::linear>(500, 1000, -100, 100) == 0, "oops!");
+    static_assert(fx::ease_int<fx::inCubic>(1000, 1000, 7, 320) == 320, "oops!");
+    static_assert(fx::ease_int<fx::inCubic>(2000, 1000, 7, 320) == 320, "oops!");
+    static_assert(fx::ease_int<fx::linear>(100000, 200001, 0, 65536) == 32768, "oops!"); // 64-bit division
+    static_assert(fx::ease_int<fx::linear>(0, 0, 5, 9) == 9, "oops!");
+
+    constexpr fx::reciprocal dur{1500};
+    EXPECT_EQ(0, fx::ease_int<fx::outBounce>(0, dur, 0, 320));
+    EXPECT_EQ(160, fx::ease_int<fx::linear>(750, dur, 0, 320));
+    EXPECT_EQ(-160, fx::ease_int<fx::linear>(750, dur, 0, -320));
+    // Overshoot and saturation
+    EXPECT_LT(fx::ease_int<fx::inBack>(300, dur, 0, 1000), 0);
+    EXPECT_EQ(std::numeric_limits<std::int32_t>::max(), fx::ease_int<fx::outBack>(1000, dur, 0, std::numeric_limits<std::int32_t>::max()));
+
+    // Correctly rounded against the exact product of the fixed-point curve
+    std::mt19937 rng{1017};
+    for(int i = 0; i < 100000; ++i)
+    {
+        const std::uint32_t d = rng() % 100000 + 1;
+        const std::uint32_t e = rng() % (d + 1);
+        const std::int32_t from = static_cast<std::int32_t>(rng() % 20001) - 10000;
+        const std::int32_t to = static_cast<std::int32_t>(rng() % 20001) - 10000;
+        const fx::q16_t c = fx::inOutSinusoidal(fx::reciprocal{d}.ratio(e));
+        const std::int32_t expected = from + static_cast<std::int32_t>(std::floor((to - from) * (c / 65536.0) + 0.5));
+        EXPECT_EQ(expected, fx::ease_int<fx::inOutSinusoidal>(e, d, from, to)) << e << '/' << d;
+    }
+}
+
+TEST(fixed, pixel)
+{
+    static_assert(fx::to_pixel(0, 200, 40) == 200 && fx::to_pixel(fx::one, 200, 40) == 40, "oops!");
+    static_assert(fx::to_pixel(fx::half, 0, 3) == 2 && fx::to_pixel(fx::half, 0, -3) == -1, "oops!"); // Half up
+    static_assert(fx::to_pixel(fx::one * 2, 0, 30000) == 32767, "oops!");
+
+    // Rounded product
+    for(fx::q16_t e = -fx::one / 2; e <= fx::one * 3 / 2; e += 97)
+    {
+        for(std::int16_t to : { -320, -1, 0, 1, 239, 320, 8000 })
+        {
+            const std::int16_t from = 17;
+            const double expected = std::floor(from + (to - from) * (e / 65536.0) + 0.5);
+            EXPECT_EQ(expected, fx::to_pixel(e, from, to)) << e << ' ' << to;
+        }
+    }
+
+    // Batch and plot
+    constexpr std::size_t wid = 289;
+    fx::q16_t e[wid + 1];
+    std::int16_t y[wid + 1], yp[wid + 1];
+    const fx::reciprocal r{wid};
+    for(std::size_t x = 0; x <= wid; ++x) { e[x] = fx::outBounce(r.ratio(static_cast<std::uint32_t>(x))); }
+    fx::to_pixels(e, y, wid + 1, 180, 60);
+    fx::plot<fx::outBounce>(yp, wid + 1, 180, 60);
+    for(std::size_t x = 0; x <= wid; ++x)
+    {
+        EXPECT_EQ(fx::to_pixel(e[x], 180, 60), y[x]) << x;
+        EXPECT_EQ(y[x], yp[x]) << x;
+        EXPECT_LE(std::fabs(yp[x] - (180 - 120 * easing::outBounce(static_cast<double>(x) / wid))), 0.5 + 1e-3) << x;
+    }
+    EXPECT_EQ(180, yp[0]);
+    EXPECT_EQ(60, yp[wid]);
+}
+
+TEST(fixed, gamma_table)
+{
+    using fade = fx::gamma_table<easing::inOutSinusoidal<double>, 120>;
+    using raw = fx::gamma_table<easing::inOutSinusoidal<double>, 256, std::ratio<1>>;
+    using back = fx::gamma_table<easing::inOutBack<double>, 1000, std::ratio<25, 10>>;
+    static_assert(std::is_same<fade::index_type, std::uint8_t>::value && std::is_same<back::index_type, std::uint16_t>::value, "oops!");
+    static_assert(fade::at(0) == 0 && fade::at(119) == 255 && fade::at(1000) == 255, "oops!");
+    static_assert(raw::at(128) == 128, "oops!");
+    static_assert(back::at(0) == 0 && back::at(999) == 255, "oops!");
+
+    auto check = [](const std::uint8_t* tbl, const std::size_t n, double (*curve)(double), const double gamma)
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const double v = std::fmin(std::fmax(curve(static_cast<double>(i) / static_cast<double>(n - 1)), 0.0), 1.0);
+            const double expected = 255.0 * std::pow(v, gamma);
+            EXPECT_LE(std::fabs(tbl[i] - expected), 0.5 + 1e-6) << i;
+        }
+    };
+    check(fade::data(), fade::size, easing::inOutSinusoidal<double>, 2.2);
+    check(raw::data(), raw::size, easing::inOutSinusoidal<double>, 1.0);
+    check(back::data(), back::size, easing::inOutBack<double>, 2.5);
+
+    // Batch
+    const std::uint8_t frames[] = { 0, 30, 60, 90, 119, 200 };
+    std::uint8_t out[sizeof(frames)]{};
+    fade::transform(frames, out, sizeof(frames));
+    for(std::size_t i = 0; i < sizeof(frames); ++i) { EXPECT_EQ(fade::at(frames[i]), out[i]); }
+}
+
+namespace
+{
+namespace q15 = goblib::easing::fx::q15;
+struct Curve15
+{
+    const char* name;
+    q15::q15_t (*fixed)(const q15::q15_t);
+    double (*d)(const double);
+};
+#define GOB_Q15_CURVE(name) { #name, q15::name, easing::name<double> }
+const Curve15 curves15[] =
+{
+    GOB_Q15_CURVE(linear),
+    GOB_Q15_CURVE(inSinusoidal), GOB_Q15_CURVE(outSinusoidal), GOB_Q15_CURVE(inOutSinusoidal),
+    GOB_Q15_CURVE(inQuadratic), GOB_Q15_CURVE(outQuadratic), GOB_Q15_CURVE(inOutQuadratic),
+    GOB_Q15_CURVE(inCubic), GOB_Q15_CURVE(outCubic), GOB_Q15_CURVE(inOutCubic),
+    GOB_Q15_CURVE(inQuartic), GOB_Q15_CURVE(outQuartic), GOB_Q15_CURVE(inOutQuartic),
+    GOB_Q15_CURVE(inQuintic), GOB_Q15_CURVE(outQuintic), GOB_Q15_CURVE(inOutQuintic),
+    GOB_Q15_CURVE(inExponential), GOB_Q15_CURVE(outExponential), GOB_Q15_CURVE(inOutExponential),
+    GOB_Q15_CURVE(inCircular), GOB_Q15_CURVE(outCircular), GOB_Q15_CURVE(inOutCircular),
+};
+#undef GOB_Q15_CURVE
+//
+}
+
+TEST(q15, basic)
+{
+    static_assert(q15::inOutCubic(q15::half) == q15::half, "oops!");
+    static_assert(q15::outSinusoidal(q15::one) == q15::one, "oops!");
+    static_assert(q15::inCircular(-100) == 0, "oops!");
+
+    for(auto& c : curves15)
+    {
+        EXPECT_EQ(0, c.fixed(0)) << c.name;
+        EXPECT_EQ(0, c.fixed(-q15::one)) << c.name; // Clamped phase
+    }
+}
+
+// All phases against double, and monotonicity
+TEST(q15, precision)
+{
+    std::printf("%-18s %10s (LSB)\n", "Curve", "vs double");
+    for(auto& c : curves15)
+    {
+        double err{};
+        q15::q15_t prev = 0;
+        for(std::int32_t t = 0; t <= q15::one; ++t)
+        {
+            const q15::q15_t v = c.fixed(static_cast<q15::q15_t>(t));
+            const double expected = std::fmin(c.d(t / 32768.0) * 32768.0, 32767.0);
+            err = std::fmax(err, std::fabs(v - expected));
+            EXPECT_GE(v, prev - 1) << c.name << " t:" << t; // Rounding noise of 1 LSB
+            prev = v;
+        }
+        std::printf("%-18s %10.2f\n", c.name, err);
+        EXPECT_LE(err, 3.0) << c.name;
+    }
+}
+
+TEST(q15, block)
+{
+    constexpr std::size_t n = 256;
+    q15::q15_t in[n], out[n], env[n];
+    for(std::size_t i = 0; i < n; ++i) { in[i] = static_cast<q15::q15_t>(i * 128); }
+
+    q15::transform<q15::inOutQuartic>(in, out, n);
+    for(std::size_t i = 0; i < n; ++i) { EXPECT_EQ(q15::inOutQuartic(in[i]), out[i]) << i; }
+
+    // Continued over blocks and saturated
+    q15::q15_t phase = q15::ramp<q15::inOutQuartic>(env, n / 2, 0, 128);
+    EXPECT_EQ(128 * 128, phase);
+    phase = q15::ramp<q15::inOutQuartic>(env + n / 2, n / 2, phase, 128);
+    EXPECT_EQ(q15::one, phase);
+    for(std::size_t i = 0; i < n; ++i) { EXPECT_EQ(out[i], env[i]) << i; }
+
+    // Decay
+    phase = q15::ramp<q15::outExponential>(env, n, q15::one, -256);
+    EXPECT_EQ(0, phase);
+    EXPECT_EQ(q15::outExponential(q15::one), env[0]);
+    EXPECT_EQ(0, env[n - 1]);
+}
+
+TEST(fixed, math)
+{
+    using namespace easing::math;
+    static_assert(sin_q16(0) == 0 && cos_q16(0) == fx::one, "oops!");
+    static_assert(exp2_q16(fx::one) == 2 * fx::one && exp2_q16(-fx::one) == fx::half, "oops!");
+    static_assert(sin_q15(16384) == q15::one && cos_q15(0) == q15::one, "oops!");
+    static_assert(exp2_q15(-32768) == q15::half, "oops!");
+
+    // Q16.16
+    double es{}, ec{}, ee{};
+    for(fx::q16_t x = -10 * fx::one; x <= 10 * fx::one; x += 7)
+    {
+        const double r = fx::to_float<double>(x);
+        es = std::fmax(es, std::fabs(fx::to_float<double>(sin_q16(x)) - std::sin(r)));
+        ec = std::fmax(ec, std::fabs(fx::to_float<double>(cos_q16(x)) - std::cos(r)));
+    }
+    for(fx::q16_t x = -16 * fx::one; x < 14 * fx::one; x += 5)
+    {
+        const double expected = std::exp2(fx::to_float<double>(x));
+        ee = std::fmax(ee, std::fabs(fx::to_float<double>(exp2_q16(x)) - expected) / std::fmax(expected, 1.0));
+    }
+    EXPECT_EQ(std::numeric_limits<fx::q16_t>::max(), exp2_q16(15 * fx::one));
+    EXPECT_EQ(0, exp2_q16(-48 * fx::one));
+
+    // Q1.15 (all inputs)
+    double es15{}, ec15{}, ee15{};
+    for(std::int32_t i = -32768; i <= 32767; ++i)
+    {
+        const auto x = static_cast<q15::q15_t>(i);
+        const double r = i / 32768.0;
+        es15 = std::fmax(es15, std::fabs(sin_q15(x) - std::fmin(std::sin(r * easing::constants::pi<double>()) * 32768.0, 32767.0)));
+        ec15 = std::fmax(ec15, std::fabs(cos_q15(x) - std::fmin(std::cos(r * easing::constants::pi<double>()) * 32768.0, 32767.0)));
+        if(i < 0) { ee15 = std::fmax(ee15, std::fabs(exp2_q15(x) - std::exp2(r) * 32768.0)); }
+    }
+    std::printf("sin_q16 %.2f cos_q16 %.2f exp2_q16 %.2f (LSB)\n", es * fx::one, ec * fx::one, ee * fx::one);
+    std::printf("sin_q15 %.2f cos_q15 %.2f exp2_q15 %.2f (LSB)\n", es15, ec15, ee15);
+    EXPECT_LE(es * fx::one, 1.0);
+    EXPECT_LE(ec * fx::one, 1.0);
+    EXPECT_LE(ee * fx::one, 1.0);
+    EXPECT_LE(es15, 1.0);
+    EXPECT_LE(ec15, 1.0);
+    EXPECT_LE(ee15, 1.0);
+}
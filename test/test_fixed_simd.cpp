@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <gob_easing_fixed_simd.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace q15 = goblib::easing::fx::q15;
+
+namespace
+{
+// All 65536 arguments (includes negative phases) and 7 more for the scalar remainder
+template<q15::q15_t (*F)(const q15::q15_t), typename I> void exhaustive(const char* name)
+{
+    std::vector<q15::q15_t> in(65536 + 7), out(in.size());
+    for(std::size_t i = 0; i < in.size(); ++i) { in[i] = static_cast<q15::q15_t>(static_cast<std::uint16_t>(i)); }
+    q15::simd::transform<F, I>(in.data(), out.data(), in.size());
+    std::size_t mismatch{};
+    for(std::size_t i = 0; i < in.size(); ++i)
+    {
+        if(out[i] != F(in[i]) && mismatch++ < 4) { ADD_FAILURE() << name << " t:" << in[i] << " " << out[i] << " != " << F(in[i]); }
+    }
+    EXPECT_EQ(0U, mismatch) << name;
+
+    // In place
+    q15::simd::transform<F, I>(in.data(), in.data(), in.size());
+    EXPECT_EQ(out, in) << name;
+}
+
+#define GOB_Q15_EXHAUSTIVE(name) exhaustive<q15::name, I>(#name)
+template<typename I> void exhaustive_all()
+{
+    GOB_Q15_EXHAUSTIVE(linear);
+    GOB_Q15_EXHAUSTIVE(inSinusoidal); GOB_Q15_EXHAUSTIVE(outSinusoidal); GOB_Q15_EXHAUSTIVE(inOutSinusoidal);
+    GOB_Q15_EXHAUSTIVE(inQuadratic); GOB_Q15_EXHAUSTIVE(outQuadratic); GOB_Q15_EXHAUSTIVE(inOutQuadratic);
+    GOB_Q15_EXHAUSTIVE(inCubic); GOB_Q15_EXHAUSTIVE(outCubic); GOB_Q15_EXHAUSTIVE(inOutCubic);
+    GOB_Q15_EXHAUSTIVE(inQuartic); GOB_Q15_EXHAUSTIVE(outQuartic); GOB_Q15_EXHAUSTIVE(inOutQuartic);
+    GOB_Q15_EXHAUSTIVE(inQuintic); GOB_Q15_EXHAUSTIVE(outQuintic); GOB_Q15_EXHAUSTIVE(inOutQuintic);
+    GOB_Q15_EXHAUSTIVE(inExponential); GOB_Q15_EXHAUSTIVE(outExponential); GOB_Q15_EXHAUSTIVE(inOutExponential);
+    GOB_Q15_EXHAUSTIVE(inCircular); GOB_Q15_EXHAUSTIVE(outCircular); GOB_Q15_EXHAUSTIVE(inOutCircular);
+}
+#undef GOB_Q15_EXHAUSTIVE
+//
+}
+
+TEST(q15_simd, native)
+{
+    exhaustive_all<q15::simd::native>();
+}
+
+TEST(q15_simd, scalar)
+{
+    exhaustive_all<q15::simd::scalar>();
+}
+
+#if defined(GOBLIB_EASING_SIMD_SSE2)
+TEST(q15_simd, sse2)
+{
+    exhaustive_all<q15::simd::sse2>();
+}
+#endif
+
+#if defined(GOBLIB_EASING_SIMD_AVX2)
+TEST(q15_simd, avx2)
+{
+    exhaustive_all<q15::simd::avx2>();
+}
+#endif
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <gob_easing.hpp>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+using namespace goblib;
+
+namespace
+{
+template<typename T, class P> struct curves
+{
+    using function = T(*)(const T);
+    static constexpr function table[] =
+    {
+        easing::linear<T, P>,
+        easing::inSinusoidal<T, P>,
+        easing::outSinusoidal<T, P>,
+        easing::inOutSinusoidal<T, P>,
+        easing::inQuadratic<T, P>,
+        easing::outQuadratic<T, P>,
+        easing::inOutQuadratic<T, P>,
+        easing::inCubic<T, P>,
+        easing::outCubic<T, P>,
+        easing::inOutCubic<T, P>,
+        easing::inQuartic<T, P>,
+        easing::outQuartic<T, P>,
+        easing::inOutQuartic<T, P>,
+        easing::inQuintic<T, P>,
+        easing::outQuintic<T, P>,
+        easing::inOutQuintic<T, P>,
+        easing::inExponential<T, P>,
+        easing::outExponential<T, P>,
+        easing::inOutExponential<T, P>,
+        easing::inCircular<T, P>,
+        easing::outCircular<T, P>,
+        easing::inOutCircular<T, P>,
+        easing::inBack<T, P>,
+        easing::outBack<T, P>,
+        easing::inOutBack<T, P>,
+        easing::inElastic<T, P>,
+        easing::outElastic<T, P>,
+        easing::inOutElastic<T, P>,
+        easing::inBounce<T, P>,
+        easing::outBounce<T, P>,
+        easing::inOutBounce<T, P>,
+    };
+    static constexpr size_t size = sizeof(table) / sizeof(table[0]);
+};
+template<typename T, class P> constexpr typename curves<T, P>::function curves<T, P>::table[];
+
+const char* name[] =
+{
+    "linear",
+    "inSinusoidal", "outSinusoidal", "inOutSinusoidal",
+    "inQuadratic", "outQuadratic", "inOutQuadratic",
+    "inCubic", "outCubic", "inOutCubic",
+    "inQuartic", "outQuartic", "inOutQuartic",
+    "inQuintic", "outQuintic", "inOutQuintic",
+    "inExponential", "outExponential", "inOutExponential",
+    "inCircular", "outCircular", "inOutCircular",
+    "inBack", "outBack", "inOutBack",
+    "inElastic", "outElastic", "inOutElastic",
+    "inBounce", "outBounce", "inOutBounce",
+};
+static_assert(sizeof(name)/sizeof(name[0]) == curves<float, easing::precision::exact>::size, "oops!");
+
+// Maximum absolute error against exact<long double>
+template<typename T, class P> long double max_error(const size_t idx)
+{
+    constexpr int32_t samples = 4096;
+    long double err{};
+    for(int32_t i = 0; i <= samples; ++i)
+    {
+        T t = (T)i / samples;
+        long double r = curves<long double, easing::precision::exact>::table[idx]((long double)t);
+        long double v = curves<T, P>::table[idx](t);
+        err = std::fmax(err, std::fabs(r - v));
+    }
+    return err;
+}
+//
+}
+
+TEST(precision, constexpr)
+{
+    constexpr float fe = easing::inOutElastic<float, easing::precision::exact>(0.3f);
+    constexpr float fb = easing::inOutElastic<float, easing::precision::balanced>(0.3f);
+    constexpr float ff = easing::inOutElastic<float, easing::precision::fast>(0.3f);
+    EXPECT_NEAR(fe, fb, 1e-6f);
+    EXPECT_NEAR(fe, ff, 1e-3f);
+    constexpr double de = easing::inExponential<double, easing::precision::exact>(0.7);
+    constexpr double db = easing::inExponential<double, easing::precision::balanced>(0.7);
+    constexpr double df = easing::inExponential<double, easing::precision::fast>(0.7);
+    EXPECT_NEAR(de, db, 1e-14);
+    EXPECT_NEAR(de, df, 1e-3);
+}
+
+TEST(precision, kernel)
+{
+    using easing::precision::balanced;
+    using easing::precision::fast;
+    for(int i = -3600; i <= 3600; ++i)
+    {
+        double x = i * 0.01;
+        EXPECT_NEAR(std::sin(x), balanced::sin(x), 1e-14) << x;
+        EXPECT_NEAR(std::cos(x), balanced::cos(x), 1e-14) << x;
+        EXPECT_NEAR(std::sin(x), fast::sin(x), 1e-4) << x;
+        EXPECT_NEAR(std::cos(x), fast::cos(x), 1e-4) << x;
+        EXPECT_NEAR(std::sin((float)x), balanced::sin((float)x), 1e-6f) << x;
+        EXPECT_NEAR(std::cos((float)x), balanced::cos((float)x), 1e-6f) << x;
+    }
+    for(int i = -2000; i <= 2000; ++i)
+    {
+        double x = i * 0.01;
+        EXPECT_NEAR(1.0, balanced::exp2(x) / std::exp2(x), 1e-14) << x;
+        EXPECT_NEAR(1.0, fast::exp2(x) / std::exp2(x), 1e-4) << x;
+        EXPECT_NEAR(1.0f, balanced::exp2((float)x) / std::exp2((float)x), 1e-6f) << x;
+    }
+    // Tiny negative arguments (x - floor(x) rounds to 1)
+    const float tiny[] = { -1e-10f, -FLT_MIN, -std::numeric_limits<float>::denorm_min(), -FLT_MIN / 1024, -1e-30f, -FLT_EPSILON / 4 };
+    for(auto x : tiny)
+    {
+        EXPECT_NEAR(1.0f, fast::exp2(x), 1e-4f) << x;
+        EXPECT_NEAR(1.0, fast::exp2(static_cast<double>(x)), 1e-4) << x;
+        EXPECT_NEAR(0.5f, fast::exp2(x - 1.0f), 1e-4f) << x;
+    }
+    static_assert(fast::exp2(-1e-10f) > 0.99f, "oops!");
+    for(auto t : { 1e-10f, FLT_MIN, 1e-30f })
+    {
+        EXPECT_NEAR((easing::outExponential<float, easing::precision::exact>(t)), (easing::outExponential<float, fast>(t)), 1e-6f) << t;
+        EXPECT_NEAR((easing::inOutElastic<float, easing::precision::exact>(t)), (easing::inOutElastic<float, fast>(t)), 1e-6f) << t;
+        EXPECT_NEAR((easing::inElastic<float, easing::precision::exact>(1.0f - t)), (easing::inElastic<float, fast>(1.0f - t)), 1e-3f) << t;
+    }
+}
+
+// Publish per-curve maximum error of each policy
+TEST(precision, max_error)
+{
+    using easing::precision::exact;
+    using easing::precision::balanced;
+    using easing::precision::fast;
+
+    std::printf("%-18s %10s %10s %10s | %10s %10s %10s\n", "max error",
+                "f exact", "f balanced", "f fast", "d exact", "d balanced", "d fast");
+    for(size_t i = 0; i < curves<float, exact>::size; ++i)
+    {
+        long double fe = max_error<float, exact>(i);
+        long double fb = max_error<float, balanced>(i);
+        long double ff = max_error<float, fast>(i);
+        long double de = max_error<double, exact>(i);
+        long double db = max_error<double, balanced>(i);
+        long double df = max_error<double, fast>(i);
+        std::printf("%-18s %10.2Le %10.2Le %10.2Le | %10.2Le %10.2Le %10.2Le\n", name[i], fe, fb, ff, de, db, df);
+
+        EXPECT_LT(fb, 1e-6L) << name[i];
+        EXPECT_LT(ff, 1e-3L) << name[i];
+        EXPECT_LT(db, 1e-12L) << name[i];
+        EXPECT_LT(df, 1e-3L) << name[i];
+    }
+}
+
+TEST(precision, long_double_as_double)
+{
+    using policy = easing::precision::long_double_as_double<easing::precision::exact>;
+    static_assert(std::is_same<easing::precision::compute_type<long double, policy>, double>::value, "oops!");
+    static_assert(std::is_same<easing::precision::compute_type<float, policy>, float>::value, "oops!");
+
+    constexpr long double cld = easing::inOutElastic<long double, policy>(0.3L);
+    EXPECT_EQ((long double)(easing::inOutElastic<double, easing::precision::exact>(0.3)), cld);
+
+    for(size_t idx = 0; idx < curves<long double, policy>::size; ++idx)
+    {
+        for(int i = 0; i <= 1000; ++i)
+        {
+            double t = (double)i / 1000;
+            auto v = curves<long double, policy>::table[idx](t);
+            auto d = curves<double, easing::precision::exact>::table[idx](t);
+            EXPECT_EQ((long double)d, v) << name[idx] << " | " << i;
+        }
+    }
+}